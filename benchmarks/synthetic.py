@@ -0,0 +1,177 @@
+### Synthetic map generators for the benchmark suite
+### These build geology, structure, unit and contact data of a requested size
+### without needing any server access or shapefiles on disk, so the benchmarks
+### in benchmarks/test_benchmarks.py give comparable timings across commits
+
+import geopandas
+import numpy
+import pandas
+import shapely
+
+# Cell size of the synthetic map grid in metres
+CELL_SIZE = 1000.0
+
+
+def synthetic_geology_map(num_polygons: int, num_units: int = 20) -> geopandas.GeoDataFrame:
+    """
+    Build a synthetic geology map as a grid of square polygons
+
+    Units are assigned in horizontal bands so that neighbouring cells share
+    units and every unit has contacts with the units above and below it.
+
+    Args:
+        num_polygons (int): the number of polygons to generate
+        num_units (int, optional): the number of distinct units. Defaults to 20.
+
+    Returns:
+        geopandas.GeoDataFrame: a geology map matching the default geology config
+    """
+    num_columns = max(int(numpy.sqrt(num_polygons)), 1)
+    index = numpy.arange(num_polygons)
+    grid_x = (index % num_columns) * CELL_SIZE
+    grid_y = (index // num_columns) * CELL_SIZE
+    polygons = shapely.polygons(
+        numpy.stack(
+            [
+                numpy.stack([grid_x, grid_y], axis=1),
+                numpy.stack([grid_x + CELL_SIZE, grid_y], axis=1),
+                numpy.stack([grid_x + CELL_SIZE, grid_y + CELL_SIZE], axis=1),
+                numpy.stack([grid_x, grid_y + CELL_SIZE], axis=1),
+            ],
+            axis=1,
+        )
+    )
+    unit_index = (index // num_columns) % num_units
+    return geopandas.GeoDataFrame(
+        {
+            "UNITNAME": [f"unit_{i}" for i in unit_index],
+            "CODE": [f"u{i}" for i in unit_index],
+            "GROUP": [f"group_{i % 4}" for i in unit_index],
+            "SUPERGROUP": "supergroup_0",
+            "DESCRIPTION": "layered sedimentary rock",
+            "ROCKTYPE1": "sedimentary",
+            "ROCKTYPE2": "",
+            "MIN_AGE": unit_index * 10.0,
+            "MAX_AGE": unit_index * 10.0 + 10.0,
+            "ID": index,
+            "geometry": polygons,
+        }
+    )
+
+
+def synthetic_units(num_units: int) -> pandas.DataFrame:
+    """
+    Build a synthetic stratigraphic unit data frame
+
+    Args:
+        num_units (int): the number of units to generate
+
+    Returns:
+        pandas.DataFrame: units with the columns the sorters expect
+    """
+    index = numpy.arange(num_units)
+    return pandas.DataFrame(
+        {
+            "layerId": index,
+            "name": [f"unit_{i}" for i in index],
+            "minAge": index * 10.0,
+            "maxAge": index * 10.0 + 10.0,
+            "group": [f"group_{i % 4}" for i in index],
+        }
+    )
+
+
+def synthetic_contacts(num_units: int) -> pandas.DataFrame:
+    """
+    Build a synthetic unit contacts data frame
+
+    Each unit contacts its stratigraphic neighbours with the longest contact
+    between direct neighbours, plus shorter spurious contacts two units apart
+    so the adjacency sorters have choices to make.
+
+    Args:
+        num_units (int): the number of units to generate contacts between
+
+    Returns:
+        pandas.DataFrame: contacts with columns ["UNITNAME_1", "UNITNAME_2", "length"]
+    """
+    unit1 = []
+    unit2 = []
+    lengths = []
+    for i in range(num_units - 1):
+        unit1.append(f"unit_{i}")
+        unit2.append(f"unit_{i + 1}")
+        lengths.append(10000.0 + (i % 7) * 100.0)
+    for i in range(num_units - 2):
+        unit1.append(f"unit_{i}")
+        unit2.append(f"unit_{i + 2}")
+        lengths.append(500.0 + (i % 5) * 10.0)
+    return pandas.DataFrame({"UNITNAME_1": unit1, "UNITNAME_2": unit2, "length": lengths})
+
+
+def synthetic_unit_relationships(num_units: int) -> pandas.DataFrame:
+    """
+    Build a synthetic unit relationships data frame
+
+    Args:
+        num_units (int): the number of units to generate relationships between
+
+    Returns:
+        pandas.DataFrame: relationships with columns ["Index1", "UnitName1", "Index2", "UnitName2"]
+    """
+    index = numpy.arange(num_units - 1)
+    return pandas.DataFrame(
+        {
+            "Index1": index,
+            "UnitName1": [f"unit_{i}" for i in index],
+            "Index2": index + 1,
+            "UnitName2": [f"unit_{i + 1}" for i in index],
+        }
+    )
+
+
+def synthetic_basal_contacts(num_units: int) -> geopandas.GeoDataFrame:
+    """
+    Build synthetic basal contact lines, one horizontal line per unit
+
+    Args:
+        num_units (int): the number of units to generate basal contacts for
+
+    Returns:
+        geopandas.GeoDataFrame: basal contacts with columns ["ID", "basal_unit", "type", "geometry"]
+    """
+    index = numpy.arange(num_units)
+    geometry = [
+        shapely.LineString([(0.0, i * CELL_SIZE), (100 * CELL_SIZE, i * CELL_SIZE)]) for i in index
+    ]
+    return geopandas.GeoDataFrame(
+        {
+            "ID": index,
+            "basal_unit": [f"unit_{i}" for i in index],
+            "type": "BASAL",
+            "geometry": geometry,
+        }
+    )
+
+
+def synthetic_structures(num_points: int, extent: float = 100 * CELL_SIZE) -> pandas.DataFrame:
+    """
+    Build synthetic structural measurements scattered over the map extent
+
+    Args:
+        num_points (int): the number of measurements to generate
+        extent (float, optional): the size of the map extent in metres
+
+    Returns:
+        pandas.DataFrame: measurements with columns ["X", "Y", "Z", "DIPDIR", "DIP"]
+    """
+    rng = numpy.random.default_rng(1234)
+    return pandas.DataFrame(
+        {
+            "X": rng.uniform(0.0, extent, num_points),
+            "Y": rng.uniform(0.0, extent, num_points),
+            "Z": numpy.zeros(num_points),
+            "DIPDIR": rng.uniform(0.0, 360.0, num_points),
+            "DIP": rng.uniform(5.0, 85.0, num_points),
+        }
+    )
@@ -0,0 +1,103 @@
+### This file benchmarks the individual pipeline stages against synthetic maps
+### so that performance regressions show up in review rather than in production.
+### Run with: pytest benchmarks/ --benchmark-only
+### Results can be compared across commits with pytest-benchmark's
+### --benchmark-autosave and --benchmark-compare options.
+###
+### Stages needing a DTM raster or server data (SamplerDecimator, the thickness
+### calculators other than ThicknessCalculatorAlpha, and
+### Project.save_into_projectfile) are not benchmarked here as they cannot be
+### driven from synthetic in-memory data alone.
+### TODO: benchmark those stages against a small cached real-data project
+
+import pytest
+
+pytest.importorskip("pytest_benchmark", reason="pytest-benchmark is not installed")
+
+from map2loop.interpolators import (
+    DipDipDirectionInterpolator,
+    IDWInterpolator,
+    NormalVectorInterpolator,
+)
+from map2loop.m2l_enums import Datatype
+from map2loop.mapdata import MapData
+from map2loop.sampler import SamplerSpacing
+from map2loop.sorter import SorterAgeBased, SorterAlpha, SorterMaximiseContacts
+from map2loop.thickness_calculator import ThicknessCalculatorAlpha
+
+from .synthetic import (
+    CELL_SIZE,
+    synthetic_basal_contacts,
+    synthetic_contacts,
+    synthetic_geology_map,
+    synthetic_structures,
+    synthetic_unit_relationships,
+    synthetic_units,
+)
+
+# Polygon counts for the map scale benchmarks
+MAP_SIZES = [1000, 10000, 100000]
+# Unit counts for the sorter benchmarks (400 matches our largest state map sheets)
+UNIT_COUNTS = [100, 400]
+# Measurement counts for the interpolator benchmarks (Rbf is quadratic in points)
+STRUCTURE_COUNTS = [250, 1000, 2000]
+
+
+@pytest.mark.parametrize("num_polygons", MAP_SIZES, ids=lambda n: f"{n // 1000}k")
+def test_parse_geology_map(benchmark, num_polygons):
+    md = MapData()
+    md.raw_data[Datatype.GEOLOGY] = synthetic_geology_map(num_polygons)
+    error, message = benchmark(md.parse_geology_map)
+    assert not error, message
+
+
+@pytest.mark.parametrize("num_polygons", MAP_SIZES, ids=lambda n: f"{n // 1000}k")
+def test_sampler_spacing(benchmark, num_polygons):
+    geology = synthetic_geology_map(num_polygons)
+    sampler = SamplerSpacing(200.0)
+    samples = benchmark(sampler.sample, geology)
+    assert len(samples) > 0
+
+
+@pytest.mark.parametrize("sorter_class", [SorterAgeBased, SorterAlpha, SorterMaximiseContacts])
+@pytest.mark.parametrize("num_units", UNIT_COUNTS)
+def test_sorter(benchmark, sorter_class, num_units):
+    units = synthetic_units(num_units)
+    contacts = synthetic_contacts(num_units)
+    unit_relationships = synthetic_unit_relationships(num_units)
+    hint = list(units["name"])
+    md = MapData()
+    md.contacts = contacts
+    order = benchmark(sorter_class().sort, units, unit_relationships, hint, contacts, md)
+    assert sorted(order) == sorted(hint)
+
+
+@pytest.mark.parametrize("num_units", UNIT_COUNTS)
+def test_thickness_calculator_alpha(benchmark, num_units):
+    units = synthetic_units(num_units)
+    stratigraphic_order = list(units["name"])
+    basal_contacts = synthetic_basal_contacts(num_units)
+    structures = synthetic_structures(num_units * 10)
+    thicknesses = benchmark(
+        ThicknessCalculatorAlpha().compute,
+        units,
+        stratigraphic_order,
+        basal_contacts,
+        structures,
+        MapData(),
+    )
+    assert len(thicknesses) == num_units
+
+
+@pytest.mark.parametrize(
+    "interpolator_class",
+    [DipDipDirectionInterpolator, NormalVectorInterpolator, IDWInterpolator],
+)
+@pytest.mark.parametrize("num_points", STRUCTURE_COUNTS)
+def test_interpolator(benchmark, interpolator_class, num_points):
+    extent = 100 * CELL_SIZE
+    bounding_box = {"minx": 0.0, "maxx": extent, "miny": 0.0, "maxy": extent}
+    structures = synthetic_structures(num_points, extent)
+    interpolator = interpolator_class()
+    result = benchmark(interpolator, bounding_box, structures)
+    assert len(result) > 0
@@ -1,2 +1,3 @@
 from .project import Project
+from .project_batch import ProjectBatch
 from .version import __version__
@@ -2,7 +2,6 @@ import pandas
 import numpy
 import beartype
 import geopandas
-import math
 
 
 class DeformationHistory:
@@ -233,14 +232,18 @@ class DeformationHistory:
         self.faults["avgNormalY"] = numpy.nan
         self.faults["avgNormalZ"] = numpy.nan
         self.faults["length"] = faults_data.geometry.length
-        for index, fault in self.faults.iterrows():
-            bounds = faults_map_data[faults_map_data["ID"] == fault["eventId"]].geometry.bounds
-            xdist = float(bounds.maxx.iloc[0] - bounds.minx.iloc[0])
-            ydist = float(bounds.maxy.iloc[0] - bounds.miny.iloc[0])
-            length = math.sqrt(xdist * xdist + ydist * ydist)
-            self.faults.at[index, "verticalRadius"] = length
-            self.faults.at[index, "horizontalRadius"] = length / 2.0
-            self.faults.at[index, "influenceDistance"] = length / 4.0
+        # The bounds of every trace come out of geopandas in one columnar call;
+        # keeping the first row per ID matches the previous per-fault lookup
+        bounds = faults_map_data.geometry.bounds
+        bounds["ID"] = faults_map_data["ID"].to_numpy()
+        bounds = bounds.drop_duplicates(subset="ID", keep="first").set_index("ID")
+        bounds = bounds.reindex(self.faults["eventId"])
+        xdist = (bounds["maxx"] - bounds["minx"]).to_numpy()
+        ydist = (bounds["maxy"] - bounds["miny"]).to_numpy()
+        length = numpy.sqrt(xdist * xdist + ydist * ydist)
+        self.faults["verticalRadius"] = length
+        self.faults["horizontalRadius"] = length / 2.0
+        self.faults["influenceDistance"] = length / 4.0
 
     @beartype.beartype
     def summarise_data(self, fault_observations: pandas.DataFrame):
@@ -251,19 +254,17 @@ class DeformationHistory:
             fault_observations (pandas.DataFrame):
                 The fault observations data
         """
-        id_list = self.faults["eventId"].unique()
-        for id in id_list:
-            observations = fault_observations[fault_observations["ID"] == id]
-            if len(observations) < 2:
-                self.removeFaultByEventId(id)
-
-        # id_list = self.faults["eventId"].unique()
-        for index, fault in self.faults.iterrows():
-            observations = fault_observations[fault_observations["ID"] == fault["eventId"]]
-            # calculate centre point
-            self.faults.at[index, "centreX"] = numpy.mean(observations["X"])
-            self.faults.at[index, "centreY"] = numpy.mean(observations["Y"])
-            self.faults.at[index, "centreZ"] = numpy.mean(observations["Z"])
+        # Drop faults with fewer than two observations using one value count
+        # rather than a per-fault filter of the observations frame
+        observation_counts = fault_observations["ID"].value_counts()
+        counts = self.faults["eventId"].map(observation_counts).fillna(0)
+        self.faults = self.faults[counts >= 2].copy()
+
+        # Calculate all the centre points with a single grouped mean
+        centres = fault_observations.groupby("ID")[["X", "Y", "Z"]].mean()
+        self.faults["centreX"] = self.faults["eventId"].map(centres["X"]).to_numpy()
+        self.faults["centreY"] = self.faults["eventId"].map(centres["Y"]).to_numpy()
+        self.faults["centreZ"] = self.faults["eventId"].map(centres["Z"]).to_numpy()
 
     def get_faults_for_export(self):
         """
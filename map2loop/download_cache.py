@@ -0,0 +1,161 @@
+import hashlib
+import os
+import time
+import beartype
+
+
+class DownloadCache:
+    """
+    A content-addressed on-disk cache for remote map data retrievals
+
+    Cached entries are keyed on the request url combined with the bounding box string
+    and working projection, so repeated Project constructions over the same (or an
+    overlapping set of) regions read from disk instead of re-downloading identical
+    WFS responses and DTM tiles.  Entries expire after a time-to-live and the cache
+    directory is pruned oldest-first when it grows past the size limit.
+
+    Attributes
+    ----------
+    cache_dir: str
+        The directory holding the cached downloads
+    ttl_seconds: float
+        How long a cached entry remains valid
+    size_limit_bytes: int
+        The maximum total size of the cache directory
+    """
+
+    def __init__(
+        self,
+        cache_dir: str = None,
+        ttl_seconds: float = 7 * 24 * 3600.0,
+        size_limit_bytes: int = 2 * 1024**3,
+    ):
+        """
+        The initialiser for the download cache
+
+        Args:
+            cache_dir (str, optional):
+                The directory to store cached downloads in. Defaults to the
+                MAP2LOOP_CACHE_DIR environment variable or ~/.cache/map2loop.
+            ttl_seconds (float, optional):
+                How long cached entries remain valid. Defaults to 7 days.
+            size_limit_bytes (int, optional):
+                The maximum total cache size before oldest entries are pruned.
+                Defaults to 2GB.
+        """
+        if cache_dir is None:
+            cache_dir = os.environ.get(
+                "MAP2LOOP_CACHE_DIR", os.path.join(os.path.expanduser("~"), ".cache", "map2loop")
+            )
+        self.cache_dir = cache_dir
+        self.ttl_seconds = ttl_seconds
+        self.size_limit_bytes = size_limit_bytes
+
+    @beartype.beartype
+    def cache_filename(self, url: str, bounding_box_str: str = "", projection: str = "") -> str:
+        """
+        Build the cache filename for a request
+
+        Args:
+            url (str): The request url
+            bounding_box_str (str, optional): The bounding box in string form. Defaults to "".
+            projection (str, optional): The working projection. Defaults to "".
+
+        Returns:
+            str: The filename the request would be cached under
+        """
+        key = hashlib.sha256(f"{url}|{bounding_box_str}|{projection}".encode("utf-8")).hexdigest()
+        # Keep a .zip suffix for zipped responses so file based readers can sniff them
+        suffix = ".zip" if ("zip" in url.lower() or url.lower().endswith(".zip")) else ".dat"
+        return os.path.join(self.cache_dir, key + suffix)
+
+    @beartype.beartype
+    def get(self, url: str, bounding_box_str: str = "", projection: str = ""):
+        """
+        Look up a request in the cache
+
+        Args:
+            url (str): The request url
+            bounding_box_str (str, optional): The bounding box in string form. Defaults to "".
+            projection (str, optional): The working projection. Defaults to "".
+
+        Returns:
+            str or None: The filename of the valid cached entry, or None on a miss
+        """
+        filename = self.cache_filename(url, bounding_box_str, projection)
+        if not os.path.isfile(filename):
+            return None
+        if time.time() - os.path.getmtime(filename) > self.ttl_seconds:
+            try:
+                os.remove(filename)
+            except OSError:
+                pass
+            return None
+        return filename
+
+    @beartype.beartype
+    def put(self, url: str, data: bytes, bounding_box_str: str = "", projection: str = "") -> str:
+        """
+        Store the response for a request in the cache and prune to the size limit
+
+        Args:
+            url (str): The request url
+            data (bytes): The response content to cache
+            bounding_box_str (str, optional): The bounding box in string form. Defaults to "".
+            projection (str, optional): The working projection. Defaults to "".
+
+        Returns:
+            str: The filename the response was cached under
+        """
+        os.makedirs(self.cache_dir, exist_ok=True)
+        filename = self.cache_filename(url, bounding_box_str, projection)
+        tmp_filename = filename + ".part"
+        with open(tmp_filename, "wb") as fh:
+            fh.write(data)
+        os.replace(tmp_filename, filename)
+        self.prune()
+        return filename
+
+    def prune(self):
+        """
+        Remove expired entries and then the oldest entries until under the size limit
+        """
+        if not os.path.isdir(self.cache_dir):
+            return
+        entries = []
+        for name in os.listdir(self.cache_dir):
+            filename = os.path.join(self.cache_dir, name)
+            if not os.path.isfile(filename):
+                continue
+            mtime = os.path.getmtime(filename)
+            if time.time() - mtime > self.ttl_seconds:
+                try:
+                    os.remove(filename)
+                except OSError:
+                    pass
+            else:
+                entries.append((mtime, filename, os.path.getsize(filename)))
+        entries.sort()
+        total_size = sum(size for _, _, size in entries)
+        for _, filename, size in entries:
+            if total_size <= self.size_limit_bytes:
+                break
+            try:
+                os.remove(filename)
+                total_size -= size
+            except OSError:
+                pass
+
+    def clear(self):
+        """
+        Remove all cached entries
+        """
+        if not os.path.isdir(self.cache_dir):
+            return
+        for name in os.listdir(self.cache_dir):
+            filename = os.path.join(self.cache_dir, name)
+            if os.path.isfile(filename):
+                try:
+                    os.remove(filename)
+                except OSError:
+                    pass
@@ -4,7 +4,9 @@ import beartype
 import numpy
 from numpy import ndarray
 from scipy.interpolate import Rbf, LinearNDInterpolator
+import scipy.spatial
 from .utils import strike_dip_vector, generate_grid
+import concurrent.futures
 import pandas
 
 
@@ -95,6 +97,45 @@ class Interpolator(ABC):
         """
         pass
 
+    def _evaluate_grid(self, function):
+        """
+        Evaluate a fitted interpolant over the grid, tiled into bounded size blocks
+
+        When tile_size is set on the interpolator the grid nodes are split into
+        blocks of at most tile_size nodes so evaluation memory stays bounded per
+        tile, and when num_workers is greater than one the blocks are evaluated
+        in a thread pool (the numpy heavy evaluation releases the GIL) so wall
+        time scales down with core count.  Without tile_size the whole grid is
+        evaluated in one shot as before.
+
+        Args:
+            function (callable): the fitted interpolant taking (xi, yi) arrays
+
+        Returns:
+            numpy.ndarray: the interpolated values at every grid node
+        """
+        tile_size = getattr(self, "tile_size", 0)
+        num_workers = getattr(self, "num_workers", 1)
+        num_nodes = len(self.xi)
+        if tile_size <= 0 or num_nodes <= tile_size:
+            return function(self.xi, self.yi)
+        tiles = [
+            slice(start, min(start + tile_size, num_nodes))
+            for start in range(0, num_nodes, tile_size)
+        ]
+        result = numpy.empty(num_nodes, dtype=numpy.float64)
+        if num_workers > 1:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=num_workers) as pool:
+                futures = {
+                    pool.submit(function, self.xi[tile], self.yi[tile]): tile for tile in tiles
+                }
+                for future in concurrent.futures.as_completed(futures):
+                    result[futures[future]] = future.result()
+        else:
+            for tile in tiles:
+                result[tile] = function(self.xi[tile], self.yi[tile])
+        return result
+
 
 class NormalVectorInterpolator(Interpolator):
     """
@@ -118,11 +159,19 @@ class NormalVectorInterpolator(Interpolator):
         interpolate(bounding_box: dict, structure_data: pandas.DataFrame, interpolator: Any) -> numpy.ndarray: Executes the interpolation method.
     """
 
-    def __init__(self):
+    def __init__(self, tile_size: int = 0, num_workers: int = 1):
         """
         Initialiser of for NormalVectorInterpolator class
+
+        Args:
+            tile_size (int, optional): the maximum number of grid nodes to evaluate
+                per tile, 0 evaluates the whole grid in one shot. Defaults to 0.
+            num_workers (int, optional): how many threads evaluate tiles in
+                parallel. Defaults to 1.
         """
         self.dataframe = None
+        self.tile_size = tile_size
+        self.num_workers = num_workers
         self.x = None
         self.y = None
         self.xi = None
@@ -249,11 +298,11 @@ class NormalVectorInterpolator(Interpolator):
         """
         if interpolator is Rbf:
             rbf = Rbf(self.x, self.y, ni, function="linear")
-            return rbf(self.xi, self.yi)
+            return self._evaluate_grid(rbf)
 
         if interpolator is LinearNDInterpolator:
             lnd_interpolator = LinearNDInterpolator(list(zip(self.x, self.y)), ni)
-            return lnd_interpolator(self.xi, self.yi)
+            return self._evaluate_grid(lnd_interpolator)
 
     @beartype.beartype
     def __call__(
@@ -298,14 +347,24 @@ class DipDipDirectionInterpolator(Interpolator):
         Interpolator(ABC): Derived from Abstract Base Class
     """
 
-    def __init__(self, data_type=None):
+    def __init__(self, data_type=None, tile_size: int = 0, num_workers: int = 1):
         """
-        Initialiser of for IDWInterpolator
+        Initialiser of for DipDipDirectionInterpolator
+
+        Args:
+            data_type (list or str, optional): which of "dip" and "dipdir" to interpolate.
+                Defaults to both.
+            tile_size (int, optional): the maximum number of grid nodes to evaluate
+                per tile, 0 evaluates the whole grid in one shot. Defaults to 0.
+            num_workers (int, optional): how many threads evaluate tiles in
+                parallel. Defaults to 1.
         """
         if data_type is None:
             self.data_type = ["dip", "dipdir"]
         else:
             self.data_type = data_type
+        self.tile_size = tile_size
+        self.num_workers = num_workers
         self.x = None
         self.y = None
         self.xi = None
@@ -370,11 +429,11 @@ class DipDipDirectionInterpolator(Interpolator):
         """
         if interpolator is Rbf:
             rbf = Rbf(self.x, self.y, ni, function="linear")
-            return rbf(self.xi, self.yi)
+            return self._evaluate_grid(rbf)
 
         if interpolator is LinearNDInterpolator:
             lnd_interpolator = LinearNDInterpolator(list(zip(self.x, self.y)), ni)
-            return lnd_interpolator(self.xi, self.yi)
+            return self._evaluate_grid(lnd_interpolator)
 
     @beartype.beartype
     def __call__(
@@ -408,3 +467,142 @@ class DipDipDirectionInterpolator(Interpolator):
 
         if self.dipdir is not None and self.dip is None:
             return self.interpolate(self.dipdir, interpolator)
+
+
+class IDWInterpolator(Interpolator):
+    """
+    Inverse distance weighted interpolator over the nearest neighbours of each grid node
+
+    Unlike the Rbf based interpolators this does not build a dense N x N system, so
+    memory and solve time scale near-linearly with the number of structure samples.
+    The samples are loaded into a scipy.spatial.cKDTree and each grid node takes the
+    inverse-distance-power weighted average of its nearest neighbours.  It accepts
+    the same data through the same __call__(bounding_box, structure_data) interface
+    as DipDipDirectionInterpolator, so it is a drop-in replacement when maps have
+    too many structure samples for a dense Rbf solve.
+
+    Args:
+        Interpolator(ABC): Derived from Abstract Base Class
+    """
+
+    def __init__(self, data_type=None, num_neighbours: int = 16, power: float = 2.0):
+        """
+        Initialiser of for IDWInterpolator
+
+        Args:
+            data_type (list or str, optional): which of "dip" and "dipdir" to interpolate.
+                Defaults to both.
+            num_neighbours (int, optional): how many nearest samples contribute to each
+                grid node. Defaults to 16.
+            power (float, optional): the inverse distance weighting power. Defaults to 2.0.
+        """
+        if data_type is None:
+            self.data_type = ["dip", "dipdir"]
+        else:
+            self.data_type = data_type
+        self.num_neighbours = num_neighbours
+        self.power = power
+        self.x = None
+        self.y = None
+        self.xi = None
+        self.yi = None
+        self.dip = None
+        self.dipdir = None
+        self.interpolator_label = "IDWInterpolator"
+
+    def type(self):
+        """
+        Getter for subclass type label
+
+        Returns:
+            str: Name of subclass
+        """
+        return self.interpolator_label
+
+    @beartype.beartype
+    def setup_interpolation(self, structure_data: pandas.DataFrame):
+        """
+        Setup the interpolation method
+
+        Args:
+            structure_data (pandas.DataFrame): sampled structural data
+        """
+        self.x = structure_data["X"].to_numpy()
+        self.y = structure_data["Y"].to_numpy()
+        if "dip" in self.data_type:
+            self.dip = structure_data["DIP"].to_numpy()
+        if "dipdir" in self.data_type:
+            self.dipdir = structure_data["DIPDIR"].to_numpy()
+
+    @beartype.beartype
+    def setup_grid(self, bounding_box: dict):
+        """
+        Setup the grid for interpolation
+
+        Args:
+            bounding_box (dict): a dictionary containing the bounding box of the map data.
+            The bounding box dictionary should comply with the following format: {
+                "minx": value,
+                "maxx": value,
+                "miny": value,
+                "maxy": value,
+            }
+        """
+        self.xi, self.yi = generate_grid(bounding_box)
+
+    @beartype.beartype
+    def interpolate(self, ni: Union[ndarray, list], interpolator: Any = None) -> numpy.ndarray:
+        """
+        Inverse Distance Weighting interpolation method
+
+        Args:
+            ni (numpy.ndarray or list): values to interpolate
+            interpolator: unused, kept for interface compatibility with the Rbf
+                based interpolators
+
+        Returns:
+            numpy.ndarray: the interpolated values at the grid nodes
+        """
+        ni = numpy.asarray(ni)
+        tree = scipy.spatial.cKDTree(numpy.column_stack([self.x, self.y]))
+        num_neighbours = min(self.num_neighbours, len(self.x))
+        distances, indexes = tree.query(
+            numpy.column_stack([self.xi, self.yi]), k=num_neighbours
+        )
+        distances = distances.reshape(len(self.xi), num_neighbours)
+        indexes = indexes.reshape(len(self.xi), num_neighbours)
+        # A tiny offset avoids dividing by zero when a grid node lands on a sample,
+        # in which case that sample dominates the weighted average
+        weights = 1.0 / (distances**self.power + 1e-12)
+        return (weights * ni[indexes]).sum(axis=1) / weights.sum(axis=1)
+
+    @beartype.beartype
+    def __call__(
+        self, bounding_box: dict, structure_data: pandas.DataFrame, interpolator: Any = None
+    ):
+        """
+        Execute interpolation method
+
+        Args:
+            bounding_box (dict): a dictionary containing the bounding box of the map data
+            structure_data (pandas.DataFrame): sampled structural data
+            interpolator: unused, kept for interface compatibility with the Rbf
+                based interpolators
+
+        Returns:
+            numpy.ndarray: interpolated dip and dip direction values
+        """
+        self.setup_interpolation(structure_data)
+        self.setup_grid(bounding_box)
+
+        # interpolate dip and dip direction
+        if self.dip is not None and self.dipdir is not None:
+            interpolated_dip = self.interpolate(self.dip)
+            interpolated_dipdir = self.interpolate(self.dipdir)
+            return numpy.array([interpolated_dip, interpolated_dipdir]).T
+
+        if self.dip is not None and self.dipdir is None:
+            return self.interpolate(self.dip)
+
+        if self.dipdir is not None and self.dip is None:
+            return self.interpolate(self.dipdir)
@@ -1,10 +1,12 @@
-import map2model
 import pandas
-import numpy
 import os
-from .m2l_enums import VerboseLevel
+from .m2l_enums import Datatype, VerboseLevel
 import re
 
+# Precompiled tokens for the map2model output file parsers
+_LEADING_INDEX_PATTERN = re.compile(r"^[0-9]*, ")
+_INTERSECTION_TUPLE_PATTERN = re.compile(r"\(([^,()]+),([^,()]+),([^,()]+)\)")
+
 
 class Map2ModelWrapper:
     """
@@ -42,6 +44,7 @@ class Map2ModelWrapper:
         self.unit_unit_relationships = None
         self.map_data = map_data
         self.verbose_level = verbose_level
+        self._output_files_ready = False
 
     def reset(self):
         """
@@ -51,6 +54,20 @@ class Map2ModelWrapper:
         self.fault_fault_relationships = None
         self.unit_fault_relationships = None
         self.unit_unit_relationships = None
+        self._output_files_ready = False
+
+    def _output_filename(self, name: str) -> str:
+        """
+        Build the path of a map2model output file
+
+        Args:
+            name (str):
+                The output file's base name
+
+        Returns:
+            str: The path of the output file in the map2model data directory
+        """
+        return os.path.join(self.map_data.tmp_path, "map2model_data", name)
 
     def get_sorted_units(self):
         """
@@ -60,7 +77,11 @@ class Map2ModelWrapper:
             list: The map2model stratigraphic column estimate
         """
         if self.sorted_units is None:
-            self.run()
+            self._ensure_run()
+        if self.sorted_units is None:
+            self.sorted_units = self._parse_sorted_units(
+                self._output_filename("units_sorted.txt")
+            )
         return self.sorted_units
 
     def get_fault_fault_relationships(self):
@@ -71,7 +92,11 @@ class Map2ModelWrapper:
             pandas.DataFrame: The fault fault relationships
         """
         if self.fault_fault_relationships is None:
-            self.run()
+            self._ensure_run()
+        if self.fault_fault_relationships is None:
+            self.fault_fault_relationships = self._parse_fault_fault_intersections(
+                self._output_filename("fault-fault-intersection.txt")
+            )
         return self.fault_fault_relationships
 
     def get_unit_fault_relationships(self):
@@ -82,7 +107,11 @@ class Map2ModelWrapper:
             pandas.DataFrame: The unit fault relationships
         """
         if self.unit_fault_relationships is None:
-            self.run()
+            self._ensure_run()
+        if self.unit_fault_relationships is None:
+            self.unit_fault_relationships = self._parse_unit_fault_intersections(
+                self._output_filename("unit-fault-intersection.txt")
+            )
         return self.unit_fault_relationships
 
     def get_unit_unit_relationships(self):
@@ -93,25 +122,21 @@ class Map2ModelWrapper:
             pandas.DataFrame: The unit unit relationships
         """
         if self.unit_unit_relationships is None:
-            self.run()
+            self._ensure_run()
+        if self.unit_unit_relationships is None:
+            self.unit_unit_relationships = self._parse_unit_unit_graph(
+                self._output_filename("graph_all_None.gml.txt")
+            )
         return self.unit_unit_relationships
 
-    def run(self, verbose_level: VerboseLevel = None):
+    def map2model_code_map(self):
         """
-        The main execute function that prepares, runs and parse the output of the map2model process
+        Build the column name and keyword mapping handed to map2model
 
-        Args:
-            verbose_level (VerboseLevel, optional):
-                How much console output is sent. Defaults to None (which uses the wrapper attribute).
+        Returns:
+            dict: The map2model field code to column name/keyword mapping
         """
-        if verbose_level is None:
-            verbose_level = self.verbose_level
-        if verbose_level != VerboseLevel.NONE:
-            print("Exporting map data for map2model")
-        self.map_data.export_wkt_format_files()
-        if verbose_level != VerboseLevel.NONE:
-            print("Running map2model...")
-        map2model_code_map = {
+        return {
             "o": "ID",  # FIELD_COORDINATES
             "f": "FEATURE",  # FIELD_FAULT_ID
             "u": "CODE",  # FIELD_POLYGON_LEVEL1_NAME
@@ -131,6 +156,109 @@ class Map2ModelWrapper:
             "volcanic": self.map_data.config.geology_config["volcanic_text"],  # VOLCANIC_STRING
             "deposit_dist": 100,  # deposit_dist
         }
+
+    def run_in_memory(self, verbose_level: VerboseLevel = None) -> bool:
+        """
+        Attempt to hand the parsed geometry and attributes directly to map2model
+
+        map2model builds with an in-memory interface accept the geology and fault
+        data frames (geometry arrays plus attribute columns) and return the
+        relationship tables as data frames, avoiding the WKT CSV round-trip
+        which costs gigabytes of temp files and minutes of I/O on statewide maps.
+
+        Args:
+            verbose_level (VerboseLevel, optional):
+                How much console output is sent. Defaults to None (which uses the wrapper attribute).
+
+        Returns:
+            bool: True if the in-memory run succeeded, False if the installed
+            map2model has no in-memory interface or the run failed, in which
+            case the caller should fall back to the file based path
+        """
+        # Deferred so importing map2loop does not pay for loading map2model
+        import map2model
+
+        if verbose_level is None:
+            verbose_level = self.verbose_level
+        if not hasattr(map2model, "run_from_dataframes"):
+            return False
+        geology = self.map_data.get_map_data(Datatype.GEOLOGY)
+        if geology is None:
+            return False
+        if verbose_level != VerboseLevel.NONE:
+            print("Running map2model in memory...")
+        try:
+            results = map2model.run_from_dataframes(
+                geology,
+                self.map_data.get_map_data(Datatype.FAULT),
+                self.map_data.get_bounding_box(),
+                self.map2model_code_map(),
+                verbose_level == VerboseLevel.NONE,
+            )
+        except Exception as e:
+            print(f"map2model in-memory run failed ({e}), falling back to file based run")
+            return False
+        self.sorted_units = list(results["sorted_units"])
+        self.fault_fault_relationships = pandas.DataFrame(
+            results["fault_fault_relationships"], columns=["Fault1", "Fault2", "Type", "Angle"]
+        )
+        self.unit_fault_relationships = pandas.DataFrame(
+            results["unit_fault_relationships"], columns=["Unit", "Fault"]
+        )
+        self.unit_unit_relationships = pandas.DataFrame(
+            results["unit_unit_relationships"],
+            columns=["Index1", "UnitName1", "Index2", "UnitName2"],
+        )
+        if verbose_level != VerboseLevel.NONE:
+            print("map2model complete")
+        return True
+
+    def run(self, verbose_level: VerboseLevel = None):
+        """
+        Execute the map2model process and parse every output product
+
+        Kept for callers that want all the products at once; the getters go
+        through _ensure_run instead and only parse the product they need.
+
+        Args:
+            verbose_level (VerboseLevel, optional):
+                How much console output is sent. Defaults to None (which uses the wrapper attribute).
+        """
+        self._ensure_run(verbose_level)
+        self.get_sorted_units()
+        self.get_fault_fault_relationships()
+        self.get_unit_fault_relationships()
+        self.get_unit_unit_relationships()
+
+    def _ensure_run(self, verbose_level: VerboseLevel = None):
+        """
+        Run the external map2model process once without parsing its outputs
+
+        Uses the in-memory map2model interface when the installed module
+        provides one, which fills every product directly.  The file based
+        fallback only executes the process and records that its output files
+        exist; each product is then parsed lazily by its getter, so runs that
+        only consume the fault relationship tables skip the unit topology
+        parsing entirely.  The external process itself still computes all the
+        products in one pass as it has no per-product entry points.
+
+        Args:
+            verbose_level (VerboseLevel, optional):
+                How much console output is sent. Defaults to None (which uses the wrapper attribute).
+        """
+        import map2model
+
+        if verbose_level is None:
+            verbose_level = self.verbose_level
+        if self.sorted_units is not None or self._output_files_ready:
+            return
+        if self.run_in_memory(verbose_level):
+            return
+        if verbose_level != VerboseLevel.NONE:
+            print("Exporting map data for map2model")
+        self.map_data.export_wkt_format_files()
+        if verbose_level != VerboseLevel.NONE:
+            print("Running map2model...")
         # TODO: Simplify. Note: this is external so have to match fix to map2model module
         run_log = map2model.run(
             os.path.join(self.map_data.tmp_path, "map2model_data"),
@@ -138,7 +266,7 @@ class Map2ModelWrapper:
             os.path.join(self.map_data.tmp_path, "map2model_data", "faults_wkt.csv"),
             "",
             self.map_data.get_bounding_box(),
-            map2model_code_map,
+            self.map2model_code_map(),
             verbose_level == VerboseLevel.NONE,
             "None",
         )
@@ -147,88 +275,121 @@ class Map2ModelWrapper:
             print(run_log)
         if verbose_level != VerboseLevel.NONE:
             print("map2model complete")
+        self._output_files_ready = True
 
-        # Parse units sorted
-        units_sorted = pandas.read_csv(
-            os.path.join(self.map_data.tmp_path, "map2model_data", "units_sorted.txt"),
-            header=None,
-            sep=' ',
-        )
+    @staticmethod
+    def _parse_sorted_units(filename: str):
+        """
+        Parse map2model's units_sorted.txt
+
+        Args:
+            filename (str):
+                The path of the units_sorted.txt file
+
+        Returns:
+            list: The map2model stratigraphic column estimate
+        """
+        units_sorted = pandas.read_csv(filename, header=None, sep=' ')
         if units_sorted.shape == 0:
-            self.sorted_units = []
-        else:
-            self.sorted_units = list(units_sorted[5])
+            return []
+        return list(units_sorted[5])
+
+    @staticmethod
+    def _parse_fault_fault_intersections(filename: str) -> pandas.DataFrame:
+        """
+        Parse map2model's fault-fault-intersection.txt in a single pass
 
-        # Parse fault intersections
+        Each line carries a fault id followed by a braced list of
+        (other fault, type, angle) tuples; the tuples are pulled out with one
+        precompiled pattern per line instead of pandas read_csv plus per-row
+        regex and list rebuilding.
+
+        Args:
+            filename (str):
+                The path of the fault-fault-intersection.txt file
+
+        Returns:
+            pandas.DataFrame: The fault to fault relationships with columns
+            ["Fault1", "Fault2", "Type", "Angle"]
+        """
         out = []
-        fault_fault_intersection_filename = os.path.join(
-            self.map_data.tmp_path, "map2model_data", "fault-fault-intersection.txt"
-        )
-        if (
-            os.path.isfile(fault_fault_intersection_filename)
-            and os.path.getsize(fault_fault_intersection_filename) > 0
-        ):
-            df = pandas.read_csv(fault_fault_intersection_filename, delimiter="{", header=None)
-            df[1] = list(df[1].str.replace("}", "", regex=False))
-            df[1] = [re.findall("\(.*?\)", i) for i in df[1]]  # Valid escape for regex
-            df[0] = list(df[0].str.replace("^[0-9]*, ", "", regex=True))
-            df[0] = list(df[0].str.replace(", ", "", regex=False))
-            df[0] = "Fault_" + df[0]
-            relations = df[1]
-            for j in range(len(relations)):
-                relations[j] = [i.strip("()").replace(" ", "").split(",") for i in relations[j]]
-            df[1] = relations
-
-            for _, row in df.iterrows():
-                for i in numpy.arange(len(row[1])):
-                    out += [[row[0], "Fault_" + row[1][i][0], row[1][i][1], float(row[1][i][2])]]
-
-        df_out = pandas.DataFrame(columns=["Fault1", "Fault2", "Type", "Angle"], data=out)
-        self.fault_fault_relationships = df_out
-
-        # Parse unit fault relationships
+        if os.path.isfile(filename) and os.path.getsize(filename) > 0:
+            with open(filename) as file:
+                for line in file:
+                    prefix, _, tuples = line.partition("{")
+                    if not tuples:
+                        continue
+                    fault1 = "Fault_" + _LEADING_INDEX_PATTERN.sub("", prefix).replace(", ", "")
+                    for match in _INTERSECTION_TUPLE_PATTERN.finditer(tuples):
+                        out.append(
+                            [
+                                fault1,
+                                "Fault_" + match.group(1).replace(" ", ""),
+                                match.group(2).replace(" ", ""),
+                                float(match.group(3)),
+                            ]
+                        )
+        return pandas.DataFrame(columns=["Fault1", "Fault2", "Type", "Angle"], data=out)
+
+    @staticmethod
+    def _parse_unit_fault_intersections(filename: str) -> pandas.DataFrame:
+        """
+        Parse map2model's unit-fault-intersection.txt in a single pass
+
+        Each line carries a unit name followed by a braced list of fault ids.
+
+        Args:
+            filename (str):
+                The path of the unit-fault-intersection.txt file
+
+        Returns:
+            pandas.DataFrame: The unit to fault relationships with columns
+            ["Unit", "Fault"]
+        """
         out = []
-        unit_fault_intersection_filename = os.path.join(
-            self.map_data.tmp_path, "map2model_data", "unit-fault-intersection.txt"
-        )
-        if (
-            os.path.isfile(unit_fault_intersection_filename)
-            and os.path.getsize(unit_fault_intersection_filename) > 0
-        ):
-            df = pandas.read_csv(unit_fault_intersection_filename, header=None, sep='{')
-            df[1] = list(df[1].str.replace("}", "", regex=False))
-            df[1] = df[1].astype(str).str.split(", ")
-            df[0] = list(df[0].str.replace("^[0-9]*, ", "", regex=True))
-            df[0] = list(df[0].str.replace(", ", "", regex=False))
-
-            for _, row in df.iterrows():
-                for i in numpy.arange(len(row[1])):
-                    out += [[row[0], "Fault_" + row[1][i]]]
-
-        df_out = pandas.DataFrame(columns=["Unit", "Fault"], data=out)
-        self.unit_fault_relationships = df_out
-
-        # Parse unit unit relationships
-        units = []
-        links = []
-        graph_filename = os.path.join(
-            self.map_data.tmp_path, "map2model_data", "graph_all_None.gml.txt"
-        )
-        if os.path.isfile(graph_filename) and os.path.getsize(graph_filename) > 0:
-            with open(
-                os.path.join(self.map_data.tmp_path, "map2model_data", "graph_all_None.gml.txt")
-            ) as file:
-                contents = file.read()
-                segments = contents.split("\n\n")
-                for line in segments[0].split("\n"):
-                    units += [line.split(" ")]
-                for line in segments[1].split("\n")[:-1]:
-                    links += [line.split(" ")]
+        if os.path.isfile(filename) and os.path.getsize(filename) > 0:
+            with open(filename) as file:
+                for line in file:
+                    prefix, _, faults = line.partition("{")
+                    if not faults:
+                        continue
+                    unit = _LEADING_INDEX_PATTERN.sub("", prefix).replace(", ", "")
+                    for fault_id in faults.replace("}", "").strip().split(", "):
+                        out.append([unit, "Fault_" + fault_id])
+        return pandas.DataFrame(columns=["Unit", "Fault"], data=out)
+
+    @staticmethod
+    def _parse_unit_unit_graph(filename: str) -> pandas.DataFrame:
+        """
+        Parse map2model's graph_all_None.gml.txt in a single pass
+
+        The file holds an index-to-unit block and a link block separated by a
+        blank line; the links are resolved through a plain dict lookup rather
+        than an indexed DataFrame built per run.
 
-        df = pandas.DataFrame(columns=["index", "unit"], data=units)
-        df.set_index("index", inplace=True)
+        Args:
+            filename (str):
+                The path of the graph_all_None.gml.txt file
+
+        Returns:
+            pandas.DataFrame: The unit to unit relationships with columns
+            ["Index1", "UnitName1", "Index2", "UnitName2"]
+        """
         out = []
-        for row in links:
-            out += [[int(row[0]), df["unit"][row[0]], int(row[1]), df["unit"][row[1]]]]
-        df_out = pandas.DataFrame(columns=["Index1", "UnitName1", "Index2", "UnitName2"], data=out)
-        self.unit_unit_relationships = df_out
+        if os.path.isfile(filename) and os.path.getsize(filename) > 0:
+            with open(filename) as file:
+                segments = file.read().split("\n\n")
+            units = {}
+            for line in segments[0].split("\n"):
+                fields = line.split(" ")
+                if len(fields) >= 2:
+                    units[fields[0]] = fields[1]
+            if len(segments) > 1:
+                for line in segments[1].split("\n")[:-1]:
+                    fields = line.split(" ")
+                    out.append(
+                        [int(fields[0]), units[fields[0]], int(fields[1]), units[fields[1]]]
+                    )
+        return pandas.DataFrame(
+            columns=["Index1", "UnitName1", "Index2", "UnitName2"], data=out
+        )
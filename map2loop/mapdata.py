@@ -2,6 +2,7 @@
 from .m2l_enums import Datatype, Datastate, VerboseLevel
 from .config import Config
 from .aus_state_urls import AustraliaStateUrls
+from .download_cache import DownloadCache
 from .utils import generate_random_hex_colors
 
 # external imports
@@ -10,13 +11,14 @@ import pandas
 import numpy
 import pathlib
 import shapely
-from osgeo import gdal, osr
-from owslib.wcs import WebCoverageService
+import scipy.sparse
 import urllib
+import concurrent.futures
 from gzip import GzipFile
 from uuid import uuid4
 import beartype
 import os
+import threading
 from io import BytesIO
 from typing import Union
 
@@ -60,7 +62,13 @@ class MapData:
         A link to the config structure which is defined in config.py
     """
 
-    def __init__(self, tmp_path: str = "", verbose_level: VerboseLevel = VerboseLevel.ALL):
+    def __init__(
+        self,
+        tmp_path: str = "",
+        verbose_level: VerboseLevel = VerboseLevel.ALL,
+        low_memory: bool = False,
+        downcast_floats: bool = False,
+    ):
         """
         The initialiser for the map data
 
@@ -69,10 +77,21 @@ class MapData:
                 The directory for storing temporary files. Defaults to "".
             verbose_level (VerboseLevel, optional):
                 How much console output is sent. Defaults to VerboseLevel.ALL.
+            low_memory (bool, optional):
+                Flag of whether to shrink parsed map layers (categorical strings)
+                and drop the raw frames after parsing, reloading them from file on
+                demand. Defaults to False.
+            downcast_floats (bool, optional):
+                Flag of whether low memory mode also downcasts float columns to
+                float32 (halves memory at the cost of sub-metre coordinate
+                precision). Defaults to False.
         """
         self.raw_data = [None] * len(Datatype)
         self.data = [None] * len(Datatype)
+        self.spatial_indexes = [None] * len(Datatype)
+        self.raster_bands = {}
         self.contacts = None
+        self.contact_matrix = None
         self.basal_contacts = None
         self.sampled_contacts = None
         self.filenames = [None] * len(Datatype)
@@ -87,8 +106,33 @@ class MapData:
         self.colour_filename = None
         self.tmp_path = tmp_path
         self.verbose_level = verbose_level
+        self.low_memory = low_memory
+        self.downcast_floats = downcast_floats
+        # GDAL datasets are not safe for concurrent reads so raster access is serialised
+        self.raster_read_lock = threading.Lock()
+        self.download_cache = DownloadCache()
+
+        self._config = Config()
+        self._pending_config_filename = None
 
-        self.config = Config()
+    @property
+    def config(self):
+        """
+        The config structure, parsing any pending config file on first access
+
+        Returns:
+            Config: The config structure
+        """
+        if self._pending_config_filename is not None:
+            filename, legacy_format, lower = self._pending_config_filename
+            self._pending_config_filename = None
+            self._config.update_from_file(filename, legacy_format=legacy_format, lower=lower)
+        return self._config
+
+    @config.setter
+    def config(self, config):
+        self._config = config
+        self._pending_config_filename = None
 
     def set_working_projection(self, projection):
         """
@@ -207,6 +251,7 @@ class MapData:
         if self.filenames[datatype] != filename:
             self.filenames[datatype] = filename
             self.data_states[datatype] = Datastate.UNLOADED
+            self.spatial_indexes[datatype] = None
             if filename == "":
                 self.dirtyflags[datatype] = False
             else:
@@ -235,7 +280,11 @@ class MapData:
         self, filename: Union[pathlib.Path, str], legacy_format: bool = False, lower: bool = False
     ):
         """
-        Set the config filename and update the config structure
+        Set the config filename and flag the config structure for updating
+
+        The file itself is parsed and validated on first access of the config
+        so that constructing a project costs nothing when the config is never
+        needed
 
         Args:
             filename (str):
@@ -244,7 +293,7 @@ class MapData:
                 Whether the file is in m2lv2 form. Defaults to False.
         """
         self.config_filename = filename
-        self.config.update_from_file(filename, legacy_format=legacy_format, lower=lower)
+        self._pending_config_filename = (filename, legacy_format, lower)
 
     def get_config_filename(self):
         """
@@ -287,6 +336,7 @@ class MapData:
         self.config.geology_config["ignore_codes"] = codes
         self.data_states[Datatype.GEOLOGY] = Datastate.CLIPPED
         self.dirtyflags[Datatype.GEOLOGY] = True
+        self.spatial_indexes[Datatype.GEOLOGY] = None
 
     @beartype.beartype
     def get_ignore_codes(self) -> list:
@@ -372,17 +422,84 @@ class MapData:
     def load_all_map_data(self):
         """
         Load all the map data for each datatype.  Cycles through each type and loads it
+
+        Remote (http) sources are prefetched concurrently into the download cache
+        before loading starts, so total download time is bounded by the slowest
+        fetch rather than their sum, and each layer is parsed as soon as its own
+        fetch has arrived while the remaining downloads continue
         """
-        for i in [
+        vector_datatypes = [
             Datatype.GEOLOGY,
             Datatype.STRUCTURE,
             Datatype.FAULT,
             Datatype.FOLD,
             Datatype.FAULT_ORIENTATION,
-        ]:
+        ]
+        fetch_tasks = {}
+        for datatype in vector_datatypes + [Datatype.DTM]:
+            task = self.__remote_fetch_task(datatype)
+            if task is not None:
+                fetch_tasks[datatype] = task
+        with concurrent.futures.ThreadPoolExecutor(
+            max_workers=max(len(fetch_tasks), 1)
+        ) as executor:
+            fetches = {
+                datatype: executor.submit(task) for datatype, task in fetch_tasks.items()
+            }
+            for i in vector_datatypes:
+                if i in fetches:
+                    fetches[i].result()
+                self.load_map_data(i)
+            if Datatype.DTM in fetches:
+                fetches[Datatype.DTM].result()
+            self.load_raster_map_data(Datatype.DTM)
+
+    @beartype.beartype
+    def __remote_fetch_task(self, datatype: Datatype):
+        """
+        Build a callable that downloads a remote source into the download cache
+
+        Only plain http(s) sources are prefetched; the "au" and "hawaii" DTM
+        sources negotiate their requests through WCS/erddap inside
+        __retrieve_tif and are left to the normal load path.  The callable
+        swallows download failures as the load stage retries the url directly.
+
+        Args:
+            datatype (Datatype):
+                The datatype whose source would be fetched
+
+        Returns:
+            callable or None: The fetch task, or None if there is nothing to prefetch
+        """
+        if self.filenames[datatype] is None or self.data_states[datatype] == Datastate.UNNAMED:
+            return None
+        if self.dirtyflags[datatype] is False or self.data_states[datatype] != Datastate.UNLOADED:
+            return None
+        if not self.filenames[datatype].startswith("http"):
+            return None
+        url = self.update_filename_with_bounding_box(self.filenames[datatype])
+        url = self.update_filename_with_projection(url)
+
+        def fetch():
+            if (
+                self.download_cache.get(
+                    url, self.bounding_box_str or "", self.working_projection or ""
+                )
+                is not None
+            ):
+                return
+            try:
+                response = urllib.request.urlopen(url, timeout=120)
+                self.download_cache.put(
+                    url,
+                    response.read(),
+                    self.bounding_box_str or "",
+                    self.working_projection or "",
+                )
+            except Exception:
+                pass
 
-            self.load_map_data(i)
-        self.load_raster_map_data(Datatype.DTM)
+        return fetch
 
     @beartype.beartype
     def load_map_data(self, datatype: Datatype):
@@ -399,13 +516,14 @@ class MapData:
             self.dirtyflags[datatype] = False
             self.data_states[datatype] = Datastate.COMPLETE
         elif self.dirtyflags[datatype] is True:
+            self.spatial_indexes[datatype] = None
             if self.data_states[datatype] == Datastate.UNLOADED:
                 # Load data from file
                 try:
                     map_filename = self.filenames[datatype]
                     map_filename = self.update_filename_with_bounding_box(map_filename)
                     map_filename = self.update_filename_with_projection(map_filename)
-                    self.raw_data[datatype] = geopandas.read_file(map_filename)
+                    self.raw_data[datatype] = self.__read_vector_map_file(map_filename)
                     self.data_states[datatype] = Datastate.LOADED
                 except Exception:
                     print(
@@ -429,6 +547,60 @@ class MapData:
                 self.data_states[datatype] = Datastate.COMPLETE
             self.dirtyflags[datatype] = False
 
+    @beartype.beartype
+    def __read_vector_map_file(self, filename: str):
+        """
+        Read a vector map file, pushing the bounding box filter down into the read
+
+        For local files the bounding box (reprojected into the file's CRS) is handed to
+        the reader so only features intersecting the area of interest are materialised,
+        meaning memory use scales with the area of interest rather than the source file.
+        Remote URL sources already carry the bounding box in their request string and
+        are served through the on-disk download cache so repeated runs over the same
+        region do not re-fetch identical responses.
+        The subsequent clip stage still trims the loaded features exactly.
+
+        Args:
+            filename (str):
+                The filename or url of the map file
+
+        Returns:
+            geopandas.GeoDataFrame: The loaded (and optionally pre-filtered) map data
+        """
+        if filename.startswith("http"):
+            cached_filename = self.download_cache.get(
+                filename, self.bounding_box_str or "", self.working_projection or ""
+            )
+            if cached_filename is None:
+                try:
+                    response = urllib.request.urlopen(filename, timeout=120)
+                    cached_filename = self.download_cache.put(
+                        filename,
+                        response.read(),
+                        self.bounding_box_str or "",
+                        self.working_projection or "",
+                    )
+                except Exception:
+                    # Fall through to a direct remote read if the download cannot be cached
+                    cached_filename = None
+            if cached_filename is not None:
+                return geopandas.read_file(cached_filename)
+            return geopandas.read_file(filename)
+        if self.bounding_box_polygon is not None:
+            try:
+                import pyogrio
+
+                file_crs = pyogrio.read_info(filename)["crs"]
+                if file_crs is not None:
+                    bounding_box = self.bounding_box_polygon.to_crs(file_crs)
+                else:
+                    bounding_box = self.bounding_box_polygon
+                return geopandas.read_file(filename, bbox=tuple(bounding_box.total_bounds))
+            except Exception:
+                # Fall back to a full read if the driver cannot filter on read
+                pass
+        return geopandas.read_file(filename)
+
     @beartype.beartype
     def get_empty_dataframe(self, datatype: Datatype):
         """
@@ -497,8 +669,11 @@ class MapData:
         Returns:
             _type_: The open geotiff in a gdal handler
         """
+        # Deferred so importing map2loop does not pay for loading gdal
+        from osgeo import gdal, osr
+
         self.__check_and_create_tmp_path()
-        
+
         # For gdal debugging use exceptions
         gdal.UseExceptions()
         bb_ll = tuple(float(coord) for coord in self.bounding_box_polygon.to_crs("EPSG:4326").geometry.total_bounds)
@@ -506,32 +681,47 @@ class MapData:
         if filename.lower() == "aus" or filename.lower() == "au":
 
             url = "http://services.ga.gov.au/gis/services/DEM_SRTM_1Second_over_Bathymetry_Topography/MapServer/WCSServer?"
-            wcs = WebCoverageService(url, version="1.0.0")
-
-            coverage = wcs.getCoverage(
-                identifier="1", bbox=bb_ll, format="GeoTIFF", crs=4326, width=2048, height=2048
+            cached_filename = self.download_cache.get(
+                url, self.bounding_box_str or "", self.working_projection or ""
             )
-            
+            if cached_filename is None:
+                from owslib.wcs import WebCoverageService
+
+                wcs = WebCoverageService(url, version="1.0.0")
+
+                coverage = wcs.getCoverage(
+                    identifier="1", bbox=bb_ll, format="GeoTIFF", crs=4326, width=2048, height=2048
+                )
+                cached_filename = self.download_cache.put(
+                    url,
+                    coverage.read(),
+                    self.bounding_box_str or "",
+                    self.working_projection or "",
+                )
+
             # This is stupid that gdal cannot read a byte stream and has to have a
             # file on the local system to open or otherwise create a gdal file
-            # from scratch with Create
+            # from scratch with Create (the cached download serves as that file)
+            tif = gdal.Open(cached_filename)
 
-            tmp_file = os.path.join(self.tmp_path, "StupidGDALLocalFile.tif")
-
-            with open(tmp_file, "wb") as fh:
-                fh.write(coverage.read())
-            tif = gdal.Open(tmp_file)
-        
         elif filename == "hawaii":
             import netCDF4
 
             bbox_str = (
                 f"[({str(bb_ll[1])}):1:({str(bb_ll[3])})][({str(bb_ll[0])}):1:({str(bb_ll[2])})]"
             )
-            
+
             filename = f"https://pae-paha.pacioos.hawaii.edu/erddap/griddap/srtm30plus_v11_land.nc?elev{bbox_str}"
-            f = urllib.request.urlopen(filename)
-            ds = netCDF4.Dataset("in-mem-file", mode="r", memory=f.read())
+            cached_filename = self.download_cache.get(
+                filename, self.bounding_box_str or "", self.working_projection or ""
+            )
+            if cached_filename is None:
+                f = urllib.request.urlopen(filename)
+                cached_filename = self.download_cache.put(
+                    filename, f.read(), self.bounding_box_str or "", self.working_projection or ""
+                )
+            with open(cached_filename, "rb") as fh:
+                ds = netCDF4.Dataset("in-mem-file", mode="r", memory=fh.read())
             spatial = [
                 ds.geospatial_lon_min,
                 ds.geospatial_lon_resolution,
@@ -554,9 +744,20 @@ class MapData:
             tif.SetProjection(srs.ExportToWkt())
             tif.GetRasterBand(1).WriteArray(numpy.flipud(ds.variables["elev"][:][:]))
         elif filename.startswith("http"):
-            image_data = self.open_http_query(filename)
-            mmap_name = f"/vsimem/{str(uuid4())}"
-            gdal.FileFromMemBuffer(mmap_name, image_data.read())
+            cached_filename = self.download_cache.get(
+                filename, self.bounding_box_str or "", self.working_projection or ""
+            )
+            if cached_filename is None:
+                image_data = self.open_http_query(filename)
+                cached_filename = self.download_cache.put(
+                    filename,
+                    image_data.read(),
+                    self.bounding_box_str or "",
+                    self.working_projection or "",
+                )
+            with open(cached_filename, "rb") as fh:
+                mmap_name = f"/vsimem/{str(uuid4())}"
+                gdal.FileFromMemBuffer(mmap_name, fh.read())
             tif = gdal.Open(mmap_name)
         else:
             tif = gdal.Open(filename, gdal.GA_ReadOnly)
@@ -575,9 +776,12 @@ class MapData:
             datatype (Datatype):
                 The raster datatype to load
         """
+        from osgeo import gdal
+
         if self.filenames[datatype] is None or self.data_states[datatype] == Datastate.UNNAMED:
             print(f"Datatype {datatype.name} is not set and so cannot be loaded\n")
         elif self.dirtyflags[datatype] is True:
+            self.raster_bands.pop(datatype, None)
             if self.data_states[datatype] == Datastate.UNLOADED:
                 # Load data from file
                 self.data[datatype] = self.__retrieve_tif(self.filenames[datatype])
@@ -640,6 +844,37 @@ class MapData:
             error, message = func()
             if error:
                 print(message)
+            elif self.low_memory:
+                self.__shrink_parsed_data(datatype)
+
+    @beartype.beartype
+    def __shrink_parsed_data(self, datatype: Datatype):
+        """
+        Reduce the memory footprint of a parsed map layer in low memory mode
+
+        Repeated string fields (unit names, groups, descriptions, rock types,
+        fault features) are converted to pandas categoricals, float columns are
+        optionally downcast to float32, and the raw frame is dropped so only the
+        parsed copy stays resident.  get_raw_map_data reloads the raw frame from
+        file on demand.
+
+        Args:
+            datatype (Datatype):
+                The datatype to shrink
+        """
+        data = self.data[datatype]
+        if data is None or type(data) is not geopandas.GeoDataFrame:
+            return
+        for column in data.columns:
+            # UNITNAME stays as plain strings as it is used as a dissolve/groupby
+            # key downstream and unobserved categories would create empty groups
+            if column in ("geometry", "UNITNAME"):
+                continue
+            if data[column].dtype == object:
+                data[column] = data[column].astype("category")
+            elif self.downcast_floats and data[column].dtype == numpy.float64:
+                data[column] = data[column].astype(numpy.float32)
+        self.raw_data[datatype] = None
 
     @beartype.beartype
     def parse_fault_orientations(self) -> tuple:
@@ -1145,8 +1380,36 @@ class MapData:
         """
         if self.data_states[datatype] != Datastate.COMPLETE or self.dirtyflags[datatype] is True:
             self.load_map_data(datatype)
+        if self.raw_data[datatype] is None and self.low_memory:
+            self.__reload_raw_map_data(datatype)
         return self.raw_data[datatype]
 
+    @beartype.beartype
+    def __reload_raw_map_data(self, datatype: Datatype):
+        """
+        Reload a raw frame that low memory mode dropped after parsing
+
+        Re-reads the file, reprojects and clips it as the load stage does, but
+        without re-running the parse so the shrunk parsed copy is untouched.
+
+        Args:
+            datatype (Datatype):
+                The datatype to reload
+        """
+        if self.filenames[datatype] is None:
+            return
+        try:
+            map_filename = self.filenames[datatype]
+            map_filename = self.update_filename_with_bounding_box(map_filename)
+            map_filename = self.update_filename_with_projection(map_filename)
+            self.raw_data[datatype] = self.__read_vector_map_file(map_filename)
+            self.set_working_projection_on_map_data(datatype)
+            self.raw_data[datatype] = geopandas.clip(
+                self.raw_data[datatype], self.bounding_box_polygon
+            )
+        except Exception:
+            print(f"Failed to reload raw {datatype.name} file called '{self.filenames[datatype]}'\n")
+
     @beartype.beartype
     def get_map_data(self, datatype: Datatype):
         """
@@ -1163,6 +1426,69 @@ class MapData:
             self.load_map_data(datatype)
         return self.data[datatype]
 
+    @beartype.beartype
+    def get_spatial_index(self, datatype: Datatype):
+        """
+        Get a cached STRtree spatial index over the parsed geometry of the specified datatype
+
+        The index is built once after the datatype is loaded and parsed, and is shared by
+        all downstream consumers so that geometry queries are O(log N) lookups rather than
+        repeated full scans.  The cache is invalidated whenever the underlying map data
+        is reloaded or reparsed.
+
+        Args:
+            datatype (Datatype):
+                The datatype of the geometry to index
+
+        Returns:
+            shapely.STRtree or None: The spatial index, or None if the data is not available
+        """
+        data = self.get_map_data(datatype)
+        if data is None or type(data) is not geopandas.GeoDataFrame:
+            print(f"Cannot build spatial index for {datatype.name} as data is not loaded")
+            return None
+        if self.spatial_indexes[datatype] is None:
+            self.spatial_indexes[datatype] = shapely.STRtree(data.geometry.values)
+        return self.spatial_indexes[datatype]
+
+    def get_contact_matrix(self):
+        """
+        Get a cached sparse matrix of total contact lengths between unit pairs
+
+        The matrix is symmetric and keyed by unit index into the returned unit name
+        list, with each entry holding the total shared boundary length between the
+        two units in metres.  It is built once from the extracted contacts and shared
+        by all Sorter subclasses so that take_best sorter comparisons do not rebuild
+        adjacency information per sorter.  The cache is invalidated whenever the
+        contacts are re-extracted.
+
+        Returns:
+            tuple: (scipy.sparse.csr_matrix, list) The contact length matrix and the
+            unit names its indexes refer to, or (None, []) if no contacts are available
+        """
+        if self.contacts is None or len(self.contacts) == 0:
+            return None, []
+        if self.contact_matrix is None:
+            unit_names = sorted(
+                set(self.contacts["UNITNAME_1"]) | set(self.contacts["UNITNAME_2"])
+            )
+            unit_indexes = {name: index for index, name in enumerate(unit_names)}
+            rows = self.contacts["UNITNAME_1"].map(unit_indexes).to_numpy()
+            cols = self.contacts["UNITNAME_2"].map(unit_indexes).to_numpy()
+            lengths = self.contacts["length"].to_numpy(dtype=numpy.float64)
+            num_units = len(unit_names)
+            # Duplicate entries are summed so repeated contact segments between the
+            # same pair of units contribute their total shared boundary length
+            matrix = scipy.sparse.coo_matrix(
+                (
+                    numpy.concatenate([lengths, lengths]),
+                    (numpy.concatenate([rows, cols]), numpy.concatenate([cols, rows])),
+                ),
+                shape=(num_units, num_units),
+            ).tocsr()
+            self.contact_matrix = (matrix, unit_names)
+        return self.contact_matrix
+
     @beartype.beartype
     def update_filename_with_bounding_box(self, filename: str):
         """
@@ -1300,69 +1626,76 @@ class MapData:
             )
 
     @beartype.beartype
-    def get_value_from_raster(self, datatype: Datatype, x, y):
+    def get_raster_band(self, datatype: Datatype):
         """
-        Get the value from a raster map at the specified point
+        Get the cached first band and inverse geotransform of a raster datatype
+
+        The band is copied out of the gdal dataset and the inverse geotransform
+        calculated only once per datatype; every subsequent lookup shares the
+        cached array instead of re-reading the whole raster.  The cache entry is
+        dropped when the raster is reloaded.
 
         Args:
             datatype (Datatype):
-                The datatype of the raster map to retrieve from
-            x (float or int):
-                The easting coordinate of the value
-            y (float or int):
-                The northing coordinate of the value
+                The raster datatype to retrieve the band of
 
         Returns:
-            float or int: The value at the point specified
+            tuple: The band as a transposed numpy array and the inverse
+            geotransform, or (None, None) if the raster is not loaded
         """
+        cached = self.raster_bands.get(datatype)
+        if cached is not None:
+            return cached
         data = self.get_map_data(datatype)
         if data is None:
-            print(f"Cannot get value from {datatype.name} data as data is not loaded")
-            return None
-        inv_geotransform = gdal.InvGeoTransform(data.GetGeoTransform())
+            return None, None
+        from osgeo import gdal
 
-        px = int(inv_geotransform[0] + inv_geotransform[1] * x + inv_geotransform[2] * y)
-        py = int(inv_geotransform[3] + inv_geotransform[4] * x + inv_geotransform[5] * y)
-        # Clamp values to the edges of raster if past boundary, similiar to GL_CLIP
-        px = max(px, 0)
-        px = min(px, data.RasterXSize - 1)
-        py = max(py, 0)
-        py = min(py, data.RasterYSize - 1)
-        val = data.ReadAsArray(px, py, 1, 1)[0][0]
-        return val
+        inv_geotransform = gdal.InvGeoTransform(data.GetGeoTransform())
+        with self.raster_read_lock:
+            band = numpy.array(data.GetRasterBand(1).ReadAsArray().T)
+        self.raster_bands[datatype] = (band, inv_geotransform)
+        return self.raster_bands[datatype]
 
     @beartype.beartype
-    def __value_from_raster(self, inv_geotransform, data, x: float, y: float):
+    def get_value_from_raster(self, datatype: Datatype, x, y):
         """
-        Get the value from a raster dataset at the specified point
+        Get the value from a raster map at the specified point
 
         Args:
-            inv_geotransform (gdal.GeoTransform):
-                The inverse of the data's geotransform
-            data (numpy.array):
-                The raster data
-            x (float):
+            datatype (Datatype):
+                The datatype of the raster map to retrieve from
+            x (float or int):
                 The easting coordinate of the value
-            y (float):
+            y (float or int):
                 The northing coordinate of the value
 
         Returns:
             float or int: The value at the point specified
         """
+        band, inv_geotransform = self.get_raster_band(datatype)
+        if band is None:
+            print(f"Cannot get value from {datatype.name} data as data is not loaded")
+            return None
+
         px = int(inv_geotransform[0] + inv_geotransform[1] * x + inv_geotransform[2] * y)
         py = int(inv_geotransform[3] + inv_geotransform[4] * x + inv_geotransform[5] * y)
         # Clamp values to the edges of raster if past boundary, similiar to GL_CLIP
         px = max(px, 0)
-        px = min(px, data.shape[0] - 1)
+        px = min(px, band.shape[0] - 1)
         py = max(py, 0)
-        py = min(py, data.shape[1] - 1)
-        return data[px][py]
+        py = min(py, band.shape[1] - 1)
+        return band[px, py]
 
     @beartype.beartype
     def get_value_from_raster_df(self, datatype: Datatype, df: pandas.DataFrame):
         """
         Add a 'Z' column to a dataframe with the heights from the 'X' and 'Y' coordinates
 
+        The inverse geotransform is applied to all points as a single numpy operation
+        and the heights come from one fancy-indexed lookup into the band cached by
+        get_raster_band rather than a fresh read of the whole raster.
+
         Args:
             datatype (Datatype):
                 The datatype of the raster map to retrieve from
@@ -1375,18 +1708,19 @@ class MapData:
         if len(df) <= 0:
             df["Z"] = []
             return df
-        data = self.get_map_data(datatype)
-        if data is None:
+        data_array, inv_geotransform = self.get_raster_band(datatype)
+        if data_array is None:
             print("Cannot get value from data as data is not loaded")
             return None
 
-        inv_geotransform = gdal.InvGeoTransform(data.GetGeoTransform())
-        data_array = numpy.array(data.GetRasterBand(1).ReadAsArray().T)
-
-        df["Z"] = df.apply(
-            lambda row: self.__value_from_raster(inv_geotransform, data_array, row["X"], row["Y"]),
-            axis=1,
-        )
+        x = df["X"].to_numpy(dtype=numpy.float64)
+        y = df["Y"].to_numpy(dtype=numpy.float64)
+        px = (inv_geotransform[0] + inv_geotransform[1] * x + inv_geotransform[2] * y).astype(int)
+        py = (inv_geotransform[3] + inv_geotransform[4] * x + inv_geotransform[5] * y).astype(int)
+        # Clamp values to the edges of raster if past boundary, similiar to GL_CLIP
+        px = numpy.clip(px, 0, data_array.shape[0] - 1)
+        py = numpy.clip(py, 0, data_array.shape[1] - 1)
+        df["Z"] = data_array[px, py]
         return df
 
     @beartype.beartype
@@ -1404,29 +1738,39 @@ class MapData:
             faults = self.get_map_data(Datatype.FAULT).copy()
             faults["geometry"] = faults.buffer(50)
             geology = geopandas.overlay(geology, faults, how="difference", keep_geom_type=False)
-        units = geology["UNITNAME"].unique()
-        column_names = ["UNITNAME_1", "UNITNAME_2", "geometry"]
-        contacts = geopandas.GeoDataFrame(crs=geology.crs, columns=column_names, data=None)
-        while len(units) > 1:
-            unit1 = units[0]
-            units = units[1:]
-            for unit2 in units:
-                if unit1 != unit2:
-                    join = geopandas.overlay(
-                        geology[geology["UNITNAME"] == unit1],
-                        geology[geology["UNITNAME"] == unit2],
-                        keep_geom_type=False,
-                    )[column_names]
-                    join["geometry"] = join.buffer(1)
-                    buffered = geology[geology["UNITNAME"] == unit2][["geometry"]].copy()
-                    buffered["geometry"] = buffered.boundary
-                    end = geopandas.overlay(buffered, join, keep_geom_type=False)
-                    if len(end):
-                        contacts = pandas.concat([contacts, end], ignore_index=True)
+        geology = geology.reset_index(drop=True)
+        # Find the unit pairs that actually touch with one spatial join rather than
+        # testing every pair of units, then extract all the shared boundaries with
+        # array based shapely calls so cost scales with the number of adjacencies
+        units_frame = geology[["UNITNAME", "geometry"]]
+        joined = geopandas.sjoin(units_frame, units_frame, predicate="intersects")
+        pairs = joined[joined.index < joined["index_right"]].sort_values(by="index_right")
+        pairs = pairs.sort_index(kind="stable")
+        index1 = pairs.index.to_numpy()
+        index2 = pairs["index_right"].to_numpy()
+        # As the units are dissolved and non-overlapping the intersection of a pair
+        # is their shared boundary, which is buffered slightly and intersected with
+        # the second unit's boundary to give the contact lines along that boundary
+        shared = shapely.intersection(
+            geology.geometry.values[index1], geology.geometry.values[index2]
+        )
+        contact_geometry = shapely.intersection(
+            shapely.boundary(geology.geometry.values[index2]), shapely.buffer(shared, 1)
+        )
+        contacts = geopandas.GeoDataFrame(
+            data={
+                "UNITNAME_1": geology["UNITNAME"].values[index1],
+                "UNITNAME_2": geology["UNITNAME"].values[index2],
+                "geometry": contact_geometry,
+            },
+            crs=geology.crs,
+        )
+        contacts = contacts[~shapely.is_empty(contacts.geometry.values)].reset_index(drop=True)
         # contacts["TYPE"] = "UNKNOWN"
         contacts["length"] = [row.length for row in contacts["geometry"]]
         if save_contacts:
             self.contacts = contacts
+            self.contact_matrix = None
         return contacts
 
     @beartype.beartype
@@ -1440,16 +1784,26 @@ class MapData:
         """
         units = stratigraphic_column
         basal_contacts = self.contacts.copy()
-        basal_contacts["ID"] = basal_contacts.apply(
-            lambda row: min(units.index(row["UNITNAME_1"]), units.index(row["UNITNAME_2"])), axis=1
-        )
-        basal_contacts["basal_unit"] = basal_contacts.apply(lambda row: units[row["ID"]], axis=1)
-        basal_contacts["distance"] = basal_contacts.apply(
-            lambda row: abs(units.index(row["UNITNAME_1"]) - units.index(row["UNITNAME_2"])), axis=1
-        )
-        basal_contacts["type"] = basal_contacts.apply(
-            lambda row: "ABNORMAL" if abs(row["distance"]) > 1 else "BASAL", axis=1
-        )
+        # Precompute the unit positions in the stratigraphic column once so the
+        # ID/basal_unit/distance/type columns come from vectorized lookups rather
+        # than an O(units) list search per row
+        unit_indexes = {unit: index for index, unit in enumerate(units)}
+        index1 = basal_contacts["UNITNAME_1"].map(unit_indexes)
+        index2 = basal_contacts["UNITNAME_2"].map(unit_indexes)
+        # Unknown units map to NaN, which would otherwise classify as "BASAL"
+        # below; raise as the positional lookup did before vectorisation
+        if index1.isna().any() or index2.isna().any():
+            missing_units = sorted(
+                set(basal_contacts.loc[index1.isna(), "UNITNAME_1"])
+                | set(basal_contacts.loc[index2.isna(), "UNITNAME_2"])
+            )
+            raise ValueError(
+                f"Units {missing_units} in the contacts are not in the stratigraphic column"
+            )
+        basal_contacts["ID"] = numpy.minimum(index1, index2)
+        basal_contacts["basal_unit"] = basal_contacts["ID"].map(dict(enumerate(units)))
+        basal_contacts["distance"] = numpy.abs(index1 - index2)
+        basal_contacts["type"] = numpy.where(basal_contacts["distance"] > 1, "ABNORMAL", "BASAL")
         basal_contacts = basal_contacts[["ID", "basal_unit", "type", "geometry"]]
         if save_contacts:
             self.basal_contacts = basal_contacts
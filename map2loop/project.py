@@ -1,23 +1,26 @@
 # internal imports
 from map2loop.fault_orientation import FaultOrientationNearest
 from .utils import hex_to_rgb
-from .m2l_enums import VerboseLevel, ErrorState, Datatype
+from .m2l_enums import VerboseLevel, ErrorState, Datatype, Datastate
 from .mapdata import MapData
 from .sampler import Sampler, SamplerDecimator, SamplerSpacing
 from .thickness_calculator import ThicknessCalculator, ThicknessCalculatorAlpha
 from .throw_calculator import ThrowCalculator, ThrowCalculatorAlpha
 from .fault_orientation import FaultOrientation
 from .sorter import Sorter, SorterAgeBased, SorterAlpha, SorterUseNetworkX, SorterUseHint
+from .stage_profiler import StageProfiler
 from .stratigraphic_column import StratigraphicColumn
 from .deformation_history import DeformationHistory
 from .map2model_wrapper import Map2ModelWrapper
+from .version import __version__
 
 # external imports
-import LoopProjectFile as LPF
 from typing import Union
-from osgeo import gdal
+import concurrent.futures
 import geopandas
 import beartype
+import hashlib
+import json
 import pathlib
 import numpy
 import pandas
@@ -49,6 +52,8 @@ class Project(object):
         The structure that holds the unit information and ordering
     deformation_history: DeformationHistory
         The structura that holds the fault and fold information and interactions
+    profiler: StageProfiler
+        The recorder of per stage wall times, memory growth and input sizes
     """
 
     @beartype.beartype
@@ -72,6 +77,7 @@ class Project(object):
         save_pre_checked_map_data: bool = False,
         loop_project_filename: str = "",
         overwrite_loopprojectfile: bool = False,
+        deferred_loading: bool = False,
         **kwargs,
     ):
         """
@@ -112,6 +118,10 @@ class Project(object):
                 A flag to save all map data to file before use. Defaults to False.
             loop_project_filename (str, optional):
                 The filename of the loop project file. Defaults to "".
+            deferred_loading (bool, optional):
+                A flag to defer loading, checking and populating the map data
+                until the first pipeline stage needs it, so construction costs
+                almost nothing for short-lived processes. Defaults to False.
 
         Raises:
             TypeError: Type of working_projection not a str or int
@@ -131,6 +141,8 @@ class Project(object):
         self.loop_filename = loop_project_filename
         self.overwrite_lpf = overwrite_loopprojectfile
 
+        self._stage_fingerprints = {}
+        self.profiler = StageProfiler()
         self.map_data = MapData(tmp_path=tmp_path, verbose_level=verbose_level)
         self.map2model = Map2ModelWrapper(self.map_data)
         self.stratigraphic_column = StratigraphicColumn()
@@ -201,12 +213,33 @@ class Project(object):
         if clut_filename != "":
             self.map_data.set_colour_filename(clut_filename)
 
+        self._data_loaded = False
+        self._save_pre_checked_map_data = save_pre_checked_map_data
+        if not deferred_loading:
+            self._ensure_data_loaded()
+
+        if len(kwargs):
+            print(f"These keywords were not used in initialising the Loop project ({kwargs})")
+
+    def _ensure_data_loaded(self):
+        """
+        Load, check and populate the map data if that work is still pending
+
+        Does nothing after the first call.  Projects built with
+        deferred_loading=True run this at the start of the first pipeline stage
+        instead of at construction, so short-lived processes that never reach a
+        pipeline stage skip the load and parse cost entirely.
+        """
+        if self._data_loaded:
+            return
+        self._data_loaded = True
+
         # Load all data (both shape and raster)
         self.map_data.load_all_map_data()
 
         # If flag to save out data is check do so
-        if save_pre_checked_map_data:
-            self.map_data.save_all_map_data(tmp_path)
+        if self._save_pre_checked_map_data:
+            self.map_data.save_all_map_data(self.map_data.tmp_path)
 
         # Populate the stratigraphic column and deformation history from map data
         self.stratigraphic_column.populate(self.map_data.get_map_data(Datatype.GEOLOGY))
@@ -219,8 +252,123 @@ class Project(object):
         )
         self.deformation_history.set_minimum_fault_length(largest_dimension * 0.05)
 
-        if len(kwargs):
-            print(f"These keywords were not used in initialising the Loop project ({kwargs})")
+    @classmethod
+    @beartype.beartype
+    def from_mapdata(
+        cls,
+        map_data: MapData,
+        bounding_box,
+        verbose_level: VerboseLevel = VerboseLevel.ALL,
+        tmp_path: str = "m2l_data_tmp",
+        loop_project_filename: str = "",
+        overwrite_loopprojectfile: bool = False,
+    ):
+        """
+        Build a Project over a sub-region of an already loaded MapData
+
+        The new project skips the load and parse steps entirely: its vector
+        layers are geopandas.clip views of the source's parsed (and raw)
+        frames, so interior geometries are shared by reference and only
+        boundary geometries are cut, its DTM is a VRT window onto the source
+        raster, and the config, colour table and download cache are shared by
+        reference.  This makes opening several projects over sub-regions of
+        one sheet cost a clip each instead of a full load.
+
+        Args:
+            map_data (MapData):
+                The already loaded and parsed map data to take views of
+            bounding_box (list or dict):
+                The boundary extents of the new project (m)
+            verbose_level (VerboseLevel, optional):
+                How much console output is sent. Defaults to VerboseLevel.ALL.
+            tmp_path (str, optional):
+                The directory for storing temporary files. Defaults to "./m2l_data_tmp".
+            loop_project_filename (str, optional):
+                The filename of the loop project file. Defaults to "".
+            overwrite_loopprojectfile (bool, optional):
+                A flag to overwrite an existing loop project file. Defaults to False.
+
+        Returns:
+            Project: The new project backed by clipped views of map_data
+        """
+        # Constructed with loading deferred so the view project never runs the
+        # filename based load step; the clipped views below take its place
+        project = cls(
+            verbose_level=verbose_level,
+            tmp_path=tmp_path,
+            working_projection=map_data.working_projection,
+            bounding_box=bounding_box,
+            loop_project_filename=loop_project_filename,
+            overwrite_loopprojectfile=overwrite_loopprojectfile,
+            deferred_loading=True,
+        )
+        target = project.map_data
+
+        # Share the configuration, colour table and caches by reference
+        target.config = map_data.config
+        target.colour_filename = map_data.colour_filename
+        target.download_cache = map_data.download_cache
+
+        # Clip the parsed source layers to the new extent.  geopandas.clip only
+        # copies the boundary geometries it has to cut; interior rows keep
+        # referencing the shared geometry objects
+        clip_polygon = target.get_bounding_box(polygon=True)
+        for datatype in [
+            Datatype.GEOLOGY,
+            Datatype.STRUCTURE,
+            Datatype.FAULT,
+            Datatype.FOLD,
+            Datatype.FAULT_ORIENTATION,
+        ]:
+            parsed = map_data.get_map_data(datatype)
+            if parsed is not None:
+                target.data[datatype] = geopandas.clip(parsed, clip_polygon)
+            raw = map_data.get_raw_map_data(datatype)
+            if raw is not None:
+                target.raw_data[datatype] = geopandas.clip(raw, clip_polygon)
+            target.data_states[datatype] = Datastate.COMPLETE
+            target.dirtyflags[datatype] = False
+            target.spatial_indexes[datatype] = None
+
+        # Window the shared DTM rather than re-warping it, and share the read
+        # lock as the windowed VRT resolves to the same underlying dataset
+        if map_data.data[Datatype.DTM] is not None:
+            from osgeo import gdal
+
+            bounding_box = target.get_bounding_box()
+            target.data[Datatype.DTM] = gdal.Translate(
+                "",
+                map_data.data[Datatype.DTM],
+                format="VRT",
+                outputType=gdal.GDT_Float32,
+                outputSRS=map_data.working_projection,
+                projWin=[
+                    bounding_box["minx"],
+                    bounding_box["maxy"],
+                    bounding_box["maxx"],
+                    bounding_box["miny"],
+                ],
+                projWinSRS=map_data.working_projection,
+            )
+            target.data_states[Datatype.DTM] = Datastate.COMPLETE
+            target.dirtyflags[Datatype.DTM] = False
+            target.raster_read_lock = map_data.raster_read_lock
+
+        # The clipped views replace the load and populate work entirely, so the
+        # deferred load must never run and overwrite them with empty frames
+        project._data_loaded = True
+
+        # Re-populate the column and fault history from the clipped views
+        if target.get_map_data(Datatype.GEOLOGY) is not None:
+            project.stratigraphic_column.populate(target.get_map_data(Datatype.GEOLOGY))
+        if target.get_map_data(Datatype.FAULT) is not None:
+            project.deformation_history.populate(target.get_map_data(Datatype.FAULT))
+        bounding_box = target.get_bounding_box()
+        largest_dimension = max(
+            bounding_box["maxx"] - bounding_box["minx"], bounding_box["maxy"] - bounding_box["miny"]
+        )
+        project.deformation_history.set_minimum_fault_length(largest_dimension * 0.05)
+        return project
 
     # Getters and Setters
     @beartype.beartype
@@ -372,60 +520,171 @@ class Project(object):
         """
         return self.deformation_history.get_minimum_fault_length()
 
+    # Incremental re-run support
+    def _frame_fingerprint(self, frame) -> str:
+        """
+        Build a content hash of a (Geo)DataFrame for stage input fingerprinting
+
+        Args:
+            frame (pandas.DataFrame or geopandas.GeoDataFrame or None):
+                The data frame to fingerprint
+
+        Returns:
+            str: A hex digest of the frame contents ("none" if the frame is not set)
+        """
+        if frame is None:
+            return "none"
+        digest = hashlib.sha256()
+        attributes = frame.drop(columns="geometry", errors="ignore")
+        digest.update(pandas.util.hash_pandas_object(attributes, index=False).values.tobytes())
+        if isinstance(frame, geopandas.GeoDataFrame) and frame.geometry.name in frame:
+            for wkb in frame.geometry.to_wkb():
+                if wkb is not None:
+                    digest.update(wkb)
+        return digest.hexdigest()
+
+    @beartype.beartype
+    def _stage_changed(self, stage: str, fingerprint: str) -> bool:
+        """
+        Check whether a pipeline stage's inputs have changed since it last ran
+
+        A stage with no recorded fingerprint is always run.  The fingerprint is
+        only recorded by _record_stage once the stage body has completed, so a
+        stage that raises is re-run on the next call rather than silently
+        skipped with stale outputs.
+
+        Args:
+            stage (str): The name of the pipeline stage
+            fingerprint (str): The fingerprint of the stage's current inputs
+
+        Returns:
+            bool: True if the stage needs to run, False if its result is current
+        """
+        return self._stage_fingerprints.get(stage) != fingerprint
+
+    @beartype.beartype
+    def _record_stage(self, stage: str, fingerprint: str):
+        """
+        Record a completed pipeline stage's input fingerprint
+
+        Args:
+            stage (str): The name of the pipeline stage
+            fingerprint (str): The fingerprint of the inputs the stage just ran with
+        """
+        self._stage_fingerprints[stage] = fingerprint
+
     # Processing functions
     def sample_map_data(self):
         """
         Use the samplers to extract points along polylines or unit boundaries
+
+        Each datatype is only re-sampled when its parsed map data or its sampler
+        has changed since the last run
         """
-        self.geology_samples = self.samplers[Datatype.GEOLOGY].sample(
-            self.map_data.get_map_data(Datatype.GEOLOGY), self.map_data
-        )
-        self.structure_samples = self.samplers[Datatype.STRUCTURE].sample(
-            self.map_data.get_map_data(Datatype.STRUCTURE), self.map_data
-        )
-        self.fault_samples = self.samplers[Datatype.FAULT].sample(
-            self.map_data.get_map_data(Datatype.FAULT), self.map_data
-        )
-        self.fold_samples = self.samplers[Datatype.FOLD].sample(
-            self.map_data.get_map_data(Datatype.FOLD), self.map_data
-        )
+        self._ensure_data_loaded()
+        sample_targets = [
+            (Datatype.GEOLOGY, "geology_samples"),
+            (Datatype.STRUCTURE, "structure_samples"),
+            (Datatype.FAULT, "fault_samples"),
+            (Datatype.FOLD, "fold_samples"),
+        ]
+        for datatype, attribute in sample_targets:
+            sampler = self.samplers[datatype]
+            fingerprint = self._frame_fingerprint(self.map_data.get_map_data(datatype)) + repr(
+                vars(sampler)
+            )
+            if (
+                self._stage_changed(f"sample_{datatype.name}", fingerprint)
+                or getattr(self, attribute, None) is None
+            ):
+                frame = self.map_data.get_map_data(datatype)
+                with self.profiler.record(
+                    "sample_map_data",
+                    component=sampler.sampler_label,
+                    input_rows={datatype.name: 0 if frame is None else len(frame)},
+                ):
+                    setattr(self, attribute, sampler.sample(frame, self.map_data))
+                self._record_stage(f"sample_{datatype.name}", fingerprint)
 
     def extract_geology_contacts(self):
         """
         Use the stratigraphic column, and fault and geology data to extract points along contacts
         """
+        self._ensure_data_loaded()
+        fingerprint = repr(self.stratigraphic_column.column) + self._frame_fingerprint(
+            self.map_data.contacts
+        )
+        if not self._stage_changed("extract_geology_contacts", fingerprint):
+            return
         # Use stratigraphic column to determine basal contacts
         self.map_data.extract_basal_contacts(self.stratigraphic_column.column)
         self.map_data.sampled_contacts = self.samplers[Datatype.GEOLOGY].sample(
             self.map_data.basal_contacts
         )
         self.map_data.get_value_from_raster_df(Datatype.DTM, self.map_data.sampled_contacts)
+        self._record_stage("extract_geology_contacts", fingerprint)
 
     def calculate_stratigraphic_order(self, take_best=False):
         """
         Use unit relationships, unit ages and the sorter to create a stratigraphic column
         """
-        if take_best:
-            sorters = [SorterUseHint(), SorterAgeBased(), SorterAlpha(), SorterUseNetworkX()]
-
-            columns = [
-                sorter.sort(
+        self._ensure_data_loaded()
+        fingerprint = (
+            self._frame_fingerprint(self.map_data.contacts)
+            + self._frame_fingerprint(self.stratigraphic_column.stratigraphicUnits)
+            + self.sorter.sorter_label
+            + repr(take_best)
+        )
+        if (
+            not self._stage_changed("calculate_stratigraphic_order", fingerprint)
+            and len(self.stratigraphic_column.column) > 0
+        ):
+            return
+        def run_sorter(sorter):
+            contacts = self.map_data.contacts
+            with self.profiler.record(
+                "calculate_stratigraphic_order",
+                component=sorter.sorter_label,
+                input_rows={
+                    "units": len(self.stratigraphic_column.stratigraphicUnits),
+                    "contacts": 0 if contacts is None else len(contacts),
+                },
+            ):
+                return sorter.sort(
                     self.stratigraphic_column.stratigraphicUnits,
                     self.map2model.get_unit_unit_relationships(),
                     self.map2model.get_sorted_units(),
-                    self.map_data.contacts,
+                    contacts,
                     self.map_data,
                 )
-                for sorter in sorters
-            ]
-            basal_contacts = [
-                self.map_data.extract_basal_contacts(column, save_contacts=False)
-                for column in columns
-            ]
-            basal_lengths = [
-                sum(list(contacts[contacts["type"] == "BASAL"]["geometry"].length))
-                for contacts in basal_contacts
-            ]
+
+        if take_best:
+            sorters = [SorterUseHint(), SorterAgeBased(), SorterAlpha(), SorterUseNetworkX()]
+
+            # Warm the shared contact matrix so the candidates score against one
+            # precomputed contact dataset instead of each building their own
+            self.map_data.get_contact_matrix()
+
+            # Warm the map2model products the sorters consume on this thread;
+            # _ensure_run has no synchronisation, so racing it from the pool
+            # would run the external process over the same output directory
+            # once per sorter
+            self.map2model.get_unit_unit_relationships()
+            self.map2model.get_sorted_units()
+
+            def score_sorter(sorter):
+                column = run_sorter(sorter)
+                contacts = self.map_data.extract_basal_contacts(column, save_contacts=False)
+                basal_length = sum(list(contacts[contacts["type"] == "BASAL"]["geometry"].length))
+                return column, basal_length
+
+            # The sorters are independent and spend their time in networkx/numpy/
+            # shapely, so evaluating them in a thread pool costs roughly one
+            # sorter's wall time instead of the sum of all of them
+            with concurrent.futures.ThreadPoolExecutor(max_workers=len(sorters)) as pool:
+                results = list(pool.map(score_sorter, sorters))
+            columns = [column for column, _ in results]
+            basal_lengths = [basal_length for _, basal_length in results]
             max_length = -1
             column = columns[0]
             best_sorter = sorters[0]
@@ -439,27 +698,49 @@ class Project(object):
             )
             self.stratigraphic_column.column = column
         else:
-            self.stratigraphic_column.column = self.sorter.sort(
-                self.stratigraphic_column.stratigraphicUnits,
-                self.map2model.get_unit_unit_relationships(),
-                self.map2model.get_sorted_units(),
-                self.map_data.contacts,
-                self.map_data,
-            )
+            self.stratigraphic_column.column = run_sorter(self.sorter)
+        self._record_stage("calculate_stratigraphic_order", fingerprint)
 
     def calculate_unit_thicknesses(self):
         """
         Use the stratigraphic column, and fault and contact data to estimate unit thicknesses
         """
-        self.stratigraphic_column.stratigraphicUnits = self.thickness_calculator.compute(
-            self.stratigraphic_column.stratigraphicUnits,
-            self.stratigraphic_column.column,
-            self.map_data.basal_contacts,
-            self.structure_samples,
-            self.map_data,
+        self._ensure_data_loaded()
+        fingerprint = (
+            self._frame_fingerprint(self.map_data.basal_contacts)
+            + self._frame_fingerprint(getattr(self, "structure_samples", None))
+            + self.thickness_calculator.thickness_calculator_label
+            + repr(self.stratigraphic_column.column)
         )
+        if not self._stage_changed("calculate_unit_thicknesses", fingerprint):
+            return
+        basal_contacts = self.map_data.basal_contacts
+        with self.profiler.record(
+            "calculate_unit_thicknesses",
+            component=self.thickness_calculator.thickness_calculator_label,
+            input_rows={
+                "basal_contacts": 0 if basal_contacts is None else len(basal_contacts),
+                "structure_samples": len(self.structure_samples),
+            },
+        ):
+            self.stratigraphic_column.stratigraphicUnits = self.thickness_calculator.compute(
+                self.stratigraphic_column.stratigraphicUnits,
+                self.stratigraphic_column.column,
+                basal_contacts,
+                self.structure_samples,
+                self.map_data,
+            )
+        self._record_stage("calculate_unit_thicknesses", fingerprint)
 
     def calculate_fault_orientations(self):
+        self._ensure_data_loaded()
+        fingerprint = (
+            self._frame_fingerprint(self.map_data.get_map_data(Datatype.FAULT))
+            + self._frame_fingerprint(self.map_data.get_map_data(Datatype.FAULT_ORIENTATION))
+            + self.fault_orientation.label
+        )
+        if not self._stage_changed("calculate_fault_orientations", fingerprint):
+            return
         if self.map_data.get_map_data(Datatype.FAULT_ORIENTATION) is not None:
             self.fault_orientations = self.fault_orientation.calculate(
                 self.map_data.get_map_data(Datatype.FAULT),
@@ -467,6 +748,7 @@ class Project(object):
                 self.map_data,
             )
             self.map_data.get_value_from_raster_df(Datatype.DTM, self.fault_orientations)
+        self._record_stage("calculate_fault_orientations", fingerprint)
 
     def apply_colour_to_units(self):
         """
@@ -486,51 +768,188 @@ class Project(object):
         """
         Use the fault shapefile to make a summary of each fault by name
         """
+        self._ensure_data_loaded()
+        fingerprint = (
+            self._frame_fingerprint(self.fault_samples)
+            + self._frame_fingerprint(self.map_data.basal_contacts)
+            + self.throw_calculator.throw_calculator_label
+            + repr(self.stratigraphic_column.column)
+        )
+        if not self._stage_changed("summarise_fault_data", fingerprint):
+            return
         self.map_data.get_value_from_raster_df(Datatype.DTM, self.fault_samples)
 
         self.deformation_history.summarise_data(self.fault_samples)
-        self.deformation_history.faults = self.throw_calculator.compute(
-            self.deformation_history.faults,
-            self.stratigraphic_column.column,
-            self.map_data.basal_contacts,
-            self.map_data,
-        )
+        with self.profiler.record(
+            "summarise_fault_data",
+            component=self.throw_calculator.throw_calculator_label,
+            input_rows={"faults": len(self.deformation_history.faults)},
+        ):
+            self.deformation_history.faults = self.throw_calculator.compute(
+                self.deformation_history.faults,
+                self.stratigraphic_column.column,
+                self.map_data.basal_contacts,
+                self.map_data,
+            )
+        self._record_stage("summarise_fault_data", fingerprint)
+
+    @beartype.beartype
+    def _run_stages_concurrently(self, stages: dict):
+        """
+        Execute pipeline stages concurrently while respecting their dependencies
+
+        Stages run in a thread pool (most stage time is spent in numpy/shapely/gdal
+        which release the GIL) and a stage is only submitted once all the stages it
+        depends on have completed.
+
+        Args:
+            stages (dict):
+                A mapping of stage name to (callable, list of dependency stage names)
+        """
+        completed = set()
+        pending = dict(stages)
+        running = {}
+        with concurrent.futures.ThreadPoolExecutor() as executor:
+            while pending or running:
+                ready = [
+                    name
+                    for name, (_, dependencies) in pending.items()
+                    if all(dependency in completed for dependency in dependencies)
+                ]
+                for name in ready:
+                    running[executor.submit(pending[name][0])] = name
+                    del pending[name]
+                if not running:
+                    raise RuntimeError(
+                        f"Stage dependency cycle or missing dependency in {list(pending.keys())}"
+                    )
+                done, _ = concurrent.futures.wait(
+                    running, return_when=concurrent.futures.FIRST_COMPLETED
+                )
+                for future in done:
+                    future.result()
+                    completed.add(running.pop(future))
 
-    def run_all(self, user_defined_stratigraphic_column=None, take_best=False):
+    def run_all(self, user_defined_stratigraphic_column=None, take_best=False, parallel=False):
         """
         Runs the full map2loop process
 
+        Repeat calls only recompute the stages whose inputs (parsed map data,
+        stratigraphic column, or the active sorter/sampler/calculator) have changed
+        since the previous run, so iterative edit/re-run loops cost seconds rather
+        than a full pipeline run.
+
+        Each stage and pluggable component call is timed into self.profiler,
+        which can be printed with profiler.print_summary() or exported with
+        profiler.to_json() after the run.
+
         Args:
             user_defined_stratigraphic_column (None or list, optional):
                 A user fed list that overrides the stratigraphic column sorter. Defaults to None.
+            parallel (bool, optional):
+                Run independent pipeline stages concurrently. Defaults to False.
         """
-        # Calculate contacts before stratigraphic column
-        self.map_data.extract_all_contacts()
-
-        # Calculate the stratigraphic column
-        if issubclass(type(user_defined_stratigraphic_column), list):
-            self.stratigraphic_column.column = user_defined_stratigraphic_column
-        else:
+        if user_defined_stratigraphic_column is not None and not issubclass(
+            type(user_defined_stratigraphic_column), list
+        ):
+            print(
+                "user_defined_stratigraphic_column is not of type list. Attempting to calculate column"
+            )
+            user_defined_stratigraphic_column = None
+
+        self._ensure_data_loaded()
+        self.profiler.clear()
+        input_rows = {}
+        for datatype in [
+            Datatype.GEOLOGY,
+            Datatype.STRUCTURE,
+            Datatype.FAULT,
+            Datatype.FOLD,
+            Datatype.FAULT_ORIENTATION,
+        ]:
+            frame = self.map_data.get_map_data(datatype)
+            if frame is not None:
+                input_rows[datatype.name] = len(frame)
+        self.profiler.set_input_rows(input_rows)
+
+        def profiled(name, function):
+            def wrapped():
+                with self.profiler.record(name):
+                    function()
+
+            return wrapped
+
+        def extract_all_contacts():
+            fingerprint = self._frame_fingerprint(
+                self.map_data.get_map_data(Datatype.GEOLOGY)
+            ) + self._frame_fingerprint(self.map_data.get_map_data(Datatype.FAULT))
+            if self._stage_changed("extract_all_contacts", fingerprint) or (
+                self.map_data.contacts is None
+            ):
+                self.map_data.extract_all_contacts()
+                self._record_stage("extract_all_contacts", fingerprint)
+
+        def calculate_column():
             if user_defined_stratigraphic_column is not None:
-                print(
-                    "user_defined_stratigraphic_column is not of type list. Attempting to calculate column"
-                )
-            self.calculate_stratigraphic_order(take_best)
-        self.sort_stratigraphic_column()
-
-        # Calculate basal contacts based on stratigraphic column
-        self.extract_geology_contacts()
-        self.sample_map_data()
-        self.calculate_unit_thicknesses()
-        self.calculate_fault_orientations()
-        self.summarise_fault_data()
-        self.apply_colour_to_units()
-        self.save_into_projectfile()
+                self.stratigraphic_column.column = user_defined_stratigraphic_column
+            else:
+                self.calculate_stratigraphic_order(take_best)
+            self.sort_stratigraphic_column()
+
+        if parallel:
+            # Model the stage dependencies so independent stages (eg. sampling and
+            # fault orientation work versus stratigraphic ordering) overlap
+            stages = {
+                "extract_all_contacts": (profiled("extract_all_contacts", extract_all_contacts), []),
+                "calculate_column": (
+                    profiled("calculate_column", calculate_column),
+                    ["extract_all_contacts"],
+                ),
+                "sample_map_data": (profiled("sample_map_data", self.sample_map_data), []),
+                "extract_geology_contacts": (
+                    profiled("extract_geology_contacts", self.extract_geology_contacts),
+                    ["calculate_column"],
+                ),
+                "calculate_unit_thicknesses": (
+                    profiled("calculate_unit_thicknesses", self.calculate_unit_thicknesses),
+                    ["extract_geology_contacts", "sample_map_data"],
+                ),
+                "calculate_fault_orientations": (
+                    profiled("calculate_fault_orientations", self.calculate_fault_orientations),
+                    [],
+                ),
+                "summarise_fault_data": (
+                    profiled("summarise_fault_data", self.summarise_fault_data),
+                    ["sample_map_data", "extract_geology_contacts", "calculate_fault_orientations"],
+                ),
+            }
+            self._run_stages_concurrently(stages)
+        else:
+            # Calculate contacts before stratigraphic column
+            profiled("extract_all_contacts", extract_all_contacts)()
+
+            # Calculate the stratigraphic column
+            profiled("calculate_column", calculate_column)()
+
+            # Calculate basal contacts based on stratigraphic column
+            profiled("extract_geology_contacts", self.extract_geology_contacts)()
+            profiled("sample_map_data", self.sample_map_data)()
+            profiled("calculate_unit_thicknesses", self.calculate_unit_thicknesses)()
+            profiled("calculate_fault_orientations", self.calculate_fault_orientations)()
+            profiled("summarise_fault_data", self.summarise_fault_data)()
+        profiled("apply_colour_to_units", self.apply_colour_to_units)()
+        profiled("save_into_projectfile", self.save_into_projectfile)()
+        if self.verbose_level != VerboseLevel.NONE:
+            self.profiler.print_summary()
 
     def save_into_projectfile(self):
         """
         Creates or updates a loop project file with all the data extracted from the map2loop process
         """
+        self._ensure_data_loaded()
+        # Deferred so importing map2loop does not pay for loading LoopProjectFile
+        import LoopProjectFile as LPF
+
         # Open project file
         if not self.loop_filename:
             self.loop_filename = os.path.join(
@@ -579,29 +998,33 @@ class Project(object):
             if not resp["errorFlag"]:
                 existing_extents = resp["value"]
 
+        # Stage all sections in memory and commit them to the file in one pass
+        sections = []
+
         # Save extents
         if existing_extents is None:
-            LPF.Set(
-                self.loop_filename,
+            sections.append((
                 "extents",
-                geodesic=[-180, -179, 0, 1],
-                utm=[
-                    1,
-                    1,
-                    self.map_data.bounding_box["minx"],
-                    self.map_data.bounding_box["maxx"],
-                    self.map_data.bounding_box["miny"],
-                    self.map_data.bounding_box["maxy"],
-                ],
-                depth=[self.map_data.bounding_box["top"], self.map_data.bounding_box["base"]],
-                spacing=[1000, 1000, 500],
-                preference="utm",
-                epsg=self.map_data.get_working_projection(),
-            )
+                dict(
+                    geodesic=[-180, -179, 0, 1],
+                    utm=[
+                        1,
+                        1,
+                        self.map_data.bounding_box["minx"],
+                        self.map_data.bounding_box["maxx"],
+                        self.map_data.bounding_box["miny"],
+                        self.map_data.bounding_box["maxy"],
+                    ],
+                    depth=[self.map_data.bounding_box["top"], self.map_data.bounding_box["base"]],
+                    spacing=[1000, 1000, 500],
+                    preference="utm",
+                    epsg=self.map_data.get_working_projection(),
+                ),
+            ))
         else:
             # TODO: Check loopfile extents match project extents before continuing
             # if mismatch on extents warn the user and create new file
-            LPF.Set(self.loop_filename, "extents", **existing_extents)
+            sections.append(("extents", dict(existing_extents)))
 
         # Save unit information
         stratigraphic_data = numpy.zeros(
@@ -641,7 +1064,7 @@ class Project(object):
         stratigraphic_data["colour2Blue"] = [
             int(a * 0.95) for a in stratigraphic_data["colour1Blue"]
         ]
-        LPF.Set(self.loop_filename, "stratigraphicLog", data=stratigraphic_data)
+        sections.append(("stratigraphicLog", dict(data=stratigraphic_data)))
 
         # Save contacts
         contacts_data = numpy.zeros(len(self.map_data.sampled_contacts), LPF.contactObservationType)
@@ -650,7 +1073,7 @@ class Project(object):
         contacts_data["northing"] = self.map_data.sampled_contacts["Y"]
         contacts_data["altitude"] = self.map_data.sampled_contacts["Z"]
         contacts_data["featureId"] = self.map_data.sampled_contacts["featureId"]
-        LPF.Set(self.loop_filename, "contacts", data=contacts_data)
+        sections.append(("contacts", dict(data=contacts_data)))
 
         # Save fault trace information
         faults_obs_data = numpy.zeros(
@@ -679,7 +1102,7 @@ class Project(object):
         faults_obs_data["dipDir"][len(self.fault_samples) :] = self.fault_orientations["DIPDIR"]
         faults_obs_data["dip"][len(self.fault_samples) :] = self.fault_orientations["DIP"]
         faults_obs_data["posOnly"][len(self.fault_samples) :] = 0
-        LPF.Set(self.loop_filename, "faultObservations", data=faults_obs_data)
+        sections.append(("faultObservations", dict(data=faults_obs_data)))
 
         faults = self.deformation_history.get_faults_for_export()
         faults_data = numpy.zeros(len(faults), LPF.faultEventType)
@@ -704,7 +1127,7 @@ class Project(object):
         faults_data["avgNormalEasting"] = faults["avgNormalX"]
         faults_data["avgNormalNorthing"] = faults["avgNormalY"]
         faults_data["avgNormalAltitude"] = faults["avgNormalZ"]
-        LPF.Set(self.loop_filename, "faultLog", data=faults_data)
+        sections.append(("faultLog", dict(data=faults_data)))
 
         # Save structural information
         observations = numpy.zeros(len(self.structure_samples), LPF.stratigraphicObservationType)
@@ -716,11 +1139,12 @@ class Project(object):
         observations["dipDir"] = self.structure_samples["DIPDIR"]
         observations["dip"] = self.structure_samples["DIP"]
         observations["dipPolarity"] = self.structure_samples["OVERTURNED"]
-        LPF.Set(self.loop_filename, "stratigraphicObservations", data=observations)
+        sections.append(("stratigraphicObservations", dict(data=observations)))
 
-        if self.map2model.fault_fault_relationships is not None:
+        fault_fault_relationships = self.map2model.get_fault_fault_relationships()
+        if fault_fault_relationships is not None:
             ff_relationships = self.deformation_history.get_fault_relationships_with_ids(
-                self.map2model.fault_fault_relationships
+                fault_fault_relationships
             )
             relationships = numpy.zeros(len(ff_relationships), LPF.eventRelationshipType)
 
@@ -729,7 +1153,33 @@ class Project(object):
             relationships["bidirectional"] = True
             relationships["angle"] = ff_relationships["Angle"]
             relationships["type"] = LPF.EventRelationshipType.FAULT_FAULT_ABUT
-            LPF.Set(self.loop_filename, "eventRelationships", data=relationships)
+            sections.append(("eventRelationships", dict(data=relationships)))
+
+        self._commit_projectfile_sections(sections)
+
+    def _commit_projectfile_sections(self, sections):
+        """
+        Write the staged project file sections in one pass
+
+        When the installed LoopProjectFile exposes a batched writer the file is
+        opened, validated and written once for all sections; older versions fall
+        back to one LPF.Set call per section, each of which reopens the file.
+
+        Args:
+            sections (list): (element name, keyword argument dict) tuples to write
+        """
+        import LoopProjectFile as LPF
+
+        if hasattr(LPF, "SetMultiple"):
+            resp = LPF.SetMultiple(
+                self.loop_filename, [(element, kwargs) for element, kwargs in sections]
+            )
+            if not resp.get("errorFlag", False):
+                return
+            print(f"Error: {resp.get('errorString', '')}")
+            print("       Batched project file write failed, retrying section by section")
+        for element, kwargs in sections:
+            LPF.Set(self.loop_filename, element, **kwargs)
 
     @beartype.beartype
     def draw_geology_map(self, points: pandas.DataFrame = None, overlay: str = ""):
@@ -742,6 +1192,7 @@ class Project(object):
             overlay (str, optional):
                 Layer of points to overlay (options are "contacts", "basal_contacts", "orientations", "faults"). Defaults to "".
         """
+        self._ensure_data_loaded()
         colour_lookup = (
             self.stratigraphic_column.stratigraphicUnits[["name", "colour"]]
             .set_index("name")
@@ -791,6 +1242,130 @@ class Project(object):
             os.mkdir(save_path)
         self.map_data.save_all_map_data(save_path, extension)
 
+    def _checkpoint_tables(self):
+        """
+        List the intermediate tables a checkpoint covers
+
+        Returns:
+            list: Tuples of (table name, owning structure, attribute name)
+        """
+        return [
+            ("geology_samples", self, "geology_samples"),
+            ("structure_samples", self, "structure_samples"),
+            ("fault_samples", self, "fault_samples"),
+            ("fold_samples", self, "fold_samples"),
+            ("fault_orientations", self, "fault_orientations"),
+            ("sampled_contacts", self.map_data, "sampled_contacts"),
+            ("contacts", self.map_data, "contacts"),
+            ("basal_contacts", self.map_data, "basal_contacts"),
+            ("fault_fault_relationships", self.map2model, "fault_fault_relationships"),
+            ("unit_fault_relationships", self.map2model, "unit_fault_relationships"),
+            ("unit_unit_relationships", self.map2model, "unit_unit_relationships"),
+            ("stratigraphicUnits", self.stratigraphic_column, "stratigraphicUnits"),
+        ]
+
+    @staticmethod
+    def _check_checkpoint_support():
+        """
+        Check that pyarrow is available for the checkpoint table formats
+
+        Raises:
+            ImportError: pyarrow is not installed
+        """
+        try:
+            import pyarrow  # noqa: F401
+        except ImportError as e:
+            raise ImportError(
+                "Checkpointing stores tables as parquet and feather which require pyarrow. "
+                "Install it with 'pip install map2loop[checkpoint]' or 'pip install pyarrow'"
+            ) from e
+
+    @beartype.beartype
+    def save_checkpoint(self, checkpoint_path: str):
+        """
+        Save the pipeline's intermediate products so a later run can resume
+
+        Every available intermediate table (the four sampled data frames, the
+        fault orientations, the contact and basal contact geometry, the
+        map2model relationship frames and the stratigraphic units) is written
+        as GeoParquet for geometry tables and feather for plain tables, along
+        with a manifest holding the stratigraphic column, the map2model sorted
+        units and the stage input fingerprints.
+
+        Args:
+            checkpoint_path (str):
+                The directory to write the checkpoint into (created if missing)
+
+        Raises:
+            ImportError: pyarrow is not installed
+        """
+        self._check_checkpoint_support()
+        os.makedirs(checkpoint_path, exist_ok=True)
+        written = []
+        for name, owner, attribute in self._checkpoint_tables():
+            frame = getattr(owner, attribute, None)
+            if frame is None:
+                continue
+            if isinstance(frame, geopandas.GeoDataFrame):
+                frame.to_parquet(os.path.join(checkpoint_path, name + ".parquet"))
+                written.append(name + ".parquet")
+            else:
+                frame.reset_index(drop=True).to_feather(
+                    os.path.join(checkpoint_path, name + ".feather")
+                )
+                written.append(name + ".feather")
+        manifest = {
+            "map2loop_version": __version__,
+            "tables": written,
+            "stage_fingerprints": self._stage_fingerprints,
+            "stratigraphic_column": list(self.stratigraphic_column.column),
+            "sorted_units": (
+                None if self.map2model.sorted_units is None else list(self.map2model.sorted_units)
+            ),
+        }
+        with open(os.path.join(checkpoint_path, "manifest.json"), "w") as file:
+            json.dump(manifest, file, indent=2)
+
+    @beartype.beartype
+    def load_checkpoint(self, checkpoint_path: str):
+        """
+        Restore the pipeline's intermediate products from a checkpoint
+
+        Tables present in the checkpoint are loaded back into their structures
+        and the recorded stage fingerprints are restored, so a subsequent
+        run_all skips the stages whose inputs are unchanged and resumes at the
+        first missing or out of date stage instead of re-running everything.
+
+        Args:
+            checkpoint_path (str):
+                The directory holding a checkpoint written by save_checkpoint
+
+        Raises:
+            ImportError: pyarrow is not installed
+        """
+        self._check_checkpoint_support()
+        with open(os.path.join(checkpoint_path, "manifest.json")) as file:
+            manifest = json.load(file)
+        if manifest.get("map2loop_version") != __version__:
+            print(
+                f"Checkpoint was written by map2loop {manifest.get('map2loop_version')} "
+                f"and is being loaded into {__version__}"
+            )
+        for name, owner, attribute in self._checkpoint_tables():
+            parquet_filename = os.path.join(checkpoint_path, name + ".parquet")
+            feather_filename = os.path.join(checkpoint_path, name + ".feather")
+            if os.path.isfile(parquet_filename):
+                setattr(owner, attribute, geopandas.read_parquet(parquet_filename))
+            elif os.path.isfile(feather_filename):
+                setattr(owner, attribute, pandas.read_feather(feather_filename))
+        if manifest.get("stratigraphic_column"):
+            self.stratigraphic_column.column = manifest["stratigraphic_column"]
+        if manifest.get("sorted_units") is not None:
+            self.map2model.sorted_units = manifest["sorted_units"]
+        self._stage_fingerprints = dict(manifest.get("stage_fingerprints", {}))
+        # The cached contact matrix derives from the restored contacts frame
+        self.map_data.contact_matrix = None
+
     @beartype.beartype
     def save_geotiff_raster(
         self, filename: str = "test.tif", projection: str = "", pixel_size: int = 25
@@ -816,6 +1391,8 @@ class Project(object):
         geol["colour_red"] = geol.apply(lambda row: int(row["colour"][1:3], 16), axis=1)
         geol["colour_green"] = geol.apply(lambda row: int(row["colour"][3:5], 16), axis=1)
         geol["colour_blue"] = geol.apply(lambda row: int(row["colour"][5:7], 16), axis=1)
+        from osgeo import gdal
+
         source_ds = gdal.OpenEx(geol.to_json())
         source_layer = source_ds.GetLayer()
         x_min, x_max, y_min, y_max = source_layer.GetExtent()
@@ -0,0 +1,259 @@
+# internal imports
+from .m2l_enums import Datatype, VerboseLevel
+from .project import Project
+from .sampler import Sampler
+from .sorter import Sorter
+from .thickness_calculator import ThicknessCalculator
+from .mapdata import MapData
+
+# external imports
+import concurrent.futures
+import beartype
+import os
+from typing import Optional
+
+
+class ProjectBatch(object):
+    """
+    A batch driver that runs the map2loop pipeline over multiple bounding boxes
+    while loading and parsing the shared source maps only once
+
+    The source layers are loaded, reprojected and parsed a single time over the
+    union of all the requested bounding boxes.  Each tile is then built with
+    Project.from_mapdata, so its map layers are clipped views of the shared
+    parsed data (interior geometries are shared by reference, only boundary
+    geometries are cut) and its DTM is a VRT window onto the shared raster,
+    making per tile setup cost a clip rather than a full load
+
+    Attributes
+    -----------
+    bounding_boxes: list
+        The list of bounding boxes (tuple or dict form) to run tiles over
+    shared_project: Project
+        The project holding the statewide data over the union extent
+    projects: list
+        The per tile Projects created by the last run_all call
+    """
+
+    @beartype.beartype
+    def __init__(
+        self,
+        bounding_boxes: list,
+        verbose_level: VerboseLevel = VerboseLevel.ALL,
+        tmp_path: str = "m2l_data_tmp",
+        loop_project_filenames=None,
+        shared_map_data: Optional[MapData] = None,
+        **project_kwargs,
+    ):
+        """
+        The initialiser for a batch of map2loop tiles over shared source data
+
+        Args:
+            bounding_boxes (list):
+                The bounding boxes of the tiles to run, each a tuple or dict as
+                accepted by Project
+            verbose_level (VerboseLevel, optional):
+                How much console output is sent. Defaults to VerboseLevel.ALL.
+            tmp_path (str, optional):
+                The directory for storing temporary files. Defaults to "./m2l_data_tmp".
+            loop_project_filenames (list, optional):
+                The loop project filename for each tile.  Defaults to
+                "tile_<index>.loop3d" inside tmp_path.
+            shared_map_data (MapData, optional):
+                An already loaded and parsed MapData to view instead of loading
+                from the filenames in project_kwargs. Defaults to None.
+            **project_kwargs:
+                The remaining Project arguments (filenames, projection, config)
+                used for the shared statewide load
+
+        Raises:
+            ValueError: bounding_boxes is empty
+            ValueError: loop_project_filenames length does not match bounding_boxes
+        """
+        if len(bounding_boxes) == 0:
+            raise ValueError("ProjectBatch requires at least one bounding box")
+        if loop_project_filenames is not None and len(loop_project_filenames) != len(
+            bounding_boxes
+        ):
+            raise ValueError(
+                f"Length of loop_project_filenames {len(loop_project_filenames)} does not match "
+                f"the number of bounding boxes {len(bounding_boxes)}"
+            )
+        self.bounding_boxes = bounding_boxes
+        self.verbose_level = verbose_level
+        self.tmp_path = tmp_path
+        self.loop_project_filenames = loop_project_filenames
+        self.project_kwargs = dict(project_kwargs)
+        # Per tile files are named individually so a single shared filename is ambiguous
+        self.project_kwargs.pop("bounding_box", None)
+        self.project_kwargs.pop("loop_project_filename", None)
+        self.projects = []
+
+        # Optional pluggable overrides applied to every tile project
+        self.sorter = None
+        self.thickness_calculator = None
+        self.samplers = {}
+
+        # Load and parse the shared source layers once over the union extent,
+        # or take views of map data the caller already loaded
+        if shared_map_data is not None:
+            self.shared_project = Project.from_mapdata(
+                shared_map_data,
+                self.__union_bounding_box(),
+                verbose_level=verbose_level,
+                tmp_path=tmp_path,
+            )
+        else:
+            self.shared_project = Project(
+                verbose_level=verbose_level,
+                tmp_path=tmp_path,
+                bounding_box=self.__union_bounding_box(),
+                **self.project_kwargs,
+            )
+
+    def __union_bounding_box(self):
+        """
+        Calculate the bounding box covering all the tile bounding boxes
+
+        Returns:
+            dict: The union bounding box in dict form
+        """
+        union = None
+        for bounding_box in self.bounding_boxes:
+            if issubclass(type(bounding_box), tuple):
+                box = {
+                    "minx": bounding_box[0],
+                    "maxx": bounding_box[1],
+                    "miny": bounding_box[2],
+                    "maxy": bounding_box[3],
+                }
+                if len(bounding_box) == 6:
+                    box["top"] = bounding_box[4]
+                    box["base"] = bounding_box[5]
+            else:
+                box = dict(bounding_box)
+            if union is None:
+                union = box
+            else:
+                union["minx"] = min(union["minx"], box["minx"])
+                union["maxx"] = max(union["maxx"], box["maxx"])
+                union["miny"] = min(union["miny"], box["miny"])
+                union["maxy"] = max(union["maxy"], box["maxy"])
+                if "top" in box and "top" in union:
+                    union["top"] = min(union["top"], box["top"])
+                if "base" in box and "base" in union:
+                    union["base"] = max(union["base"], box["base"])
+        return union
+
+    @beartype.beartype
+    def set_sorter(self, sorter: Sorter):
+        """
+        Set the sorter used by every tile project
+
+        Args:
+            sorter (Sorter):
+                The sorter to use.  Must be of base class Sorter
+        """
+        self.sorter = sorter
+
+    @beartype.beartype
+    def set_thickness_calculator(self, thickness_calculator: ThicknessCalculator):
+        """
+        Set the thickness calculator used by every tile project
+
+        Args:
+            thickness_calculator (ThicknessCalculator):
+                The thickness calculator to use.  Must be of base class ThicknessCalculator
+        """
+        self.thickness_calculator = thickness_calculator
+
+    @beartype.beartype
+    def set_sampler(self, datatype: Datatype, sampler: Sampler):
+        """
+        Set the point sampler used by every tile project for a specific datatype
+
+        Args:
+            datatype (Datatype):
+                The datatype to use this sampler on
+            sampler (Sampler):
+                The sampler to use
+        """
+        self.samplers[datatype] = sampler
+
+    @beartype.beartype
+    def create_tile_project(self, index: int) -> Project:
+        """
+        Create a Project for one tile backed by clipped views of the shared data
+
+        Args:
+            index (int):
+                The index of the tile bounding box to build a project for
+
+        Returns:
+            Project: The tile project, ready to run
+        """
+        if self.loop_project_filenames is not None:
+            loop_filename = self.loop_project_filenames[index]
+        else:
+            loop_filename = os.path.join(self.tmp_path, f"tile_{index}.loop3d")
+        # Each tile works in its own subdirectory so concurrently running tiles
+        # cannot race on the shared map2model_data files
+        tile_tmp_path = os.path.join(self.tmp_path, f"tile_{index}")
+        os.makedirs(tile_tmp_path, exist_ok=True)
+        tile = Project.from_mapdata(
+            self.shared_project.map_data,
+            self.bounding_boxes[index],
+            verbose_level=self.verbose_level,
+            tmp_path=tile_tmp_path,
+            loop_project_filename=loop_filename,
+        )
+
+        # Apply any batch wide pluggable overrides
+        if self.sorter is not None:
+            tile.set_sorter(self.sorter)
+        if self.thickness_calculator is not None:
+            tile.set_thickness_calculator(self.thickness_calculator)
+        for datatype, sampler in self.samplers.items():
+            tile.set_sampler(datatype, sampler)
+        return tile
+
+    @beartype.beartype
+    def run_all(
+        self,
+        user_defined_stratigraphic_column=None,
+        take_best: bool = False,
+        parallel_tiles: bool = False,
+    ):
+        """
+        Runs the full map2loop process on every tile
+
+        Args:
+            user_defined_stratigraphic_column (None or list, optional):
+                A user fed list that overrides the stratigraphic column sorter
+                on every tile. Defaults to None.
+            take_best (bool, optional):
+                Run all sorting algorithms on each tile and use the best. Defaults to False.
+            parallel_tiles (bool, optional):
+                Run the tiles concurrently in a thread pool.  Most tile time is
+                spent in numpy/shapely/gdal which release the GIL, and raster
+                reads on the shared DTM are serialised by the shared read lock.
+                Defaults to False.
+
+        Returns:
+            list: The per tile Projects with their results
+        """
+        self.projects = [self.create_tile_project(index) for index in range(len(self.bounding_boxes))]
+
+        def run_tile(project):
+            project.run_all(
+                user_defined_stratigraphic_column=user_defined_stratigraphic_column,
+                take_best=take_best,
+            )
+
+        if parallel_tiles and len(self.projects) > 1:
+            with concurrent.futures.ThreadPoolExecutor() as pool:
+                list(pool.map(run_tile, self.projects))
+        else:
+            for project in self.projects:
+                run_tile(project)
+        return self.projects
@@ -88,9 +88,16 @@ class SamplerDecimator(Sampler):
         data["X"] = data.geometry.x
         data["Y"] = data.geometry.y
         data["Z"] = map_data.get_value_from_raster_df(Datatype.DTM, data)["Z"]
-        data["layerID"] = geopandas.sjoin(
-            data, map_data.get_map_data(Datatype.GEOLOGY), how='left'
-        )['index_right']
+        # Query the shared cached STRtree on the geology layer rather than
+        # building a fresh index for every sjoin on the same geometry
+        geology_index = map_data.get_spatial_index(Datatype.GEOLOGY)
+        layer_ids = numpy.full(len(data), numpy.nan)
+        if geology_index is not None:
+            point_indexes, polygon_indexes = geology_index.query(
+                data.geometry.values, predicate="intersects"
+            )
+            layer_ids[point_indexes] = polygon_indexes
+        data["layerID"] = layer_ids
         data.reset_index(drop=True, inplace=True)
 
         return pandas.DataFrame(data[:: self.decimation].drop(columns="geometry"))
@@ -130,51 +137,68 @@ class SamplerSpacing(Sampler):
             pandas.DataFrame: the sampled data points
         """
         schema = {"ID": str, "X": float, "Y": float, "featureId": str}
-        df = pandas.DataFrame(columns=schema.keys()).astype(schema)
+
+        # Flatten each geometry into its target lines (polygon rings or line parts)
+        # so all of them can be sampled with a single array based interpolation call.
+        # Rings come straight out of the polygon structure, where every hole
+        # already knows its parent, so interior rings inherit the featureId of
+        # their enclosing polygon part without any pairwise containment testing
+        target_list = []
+        target_ids = []
+        target_feature_ids = []
         for _, row in spatial_data.iterrows():
             if type(row.geometry) is shapely.geometry.multipolygon.MultiPolygon:
-                targets = row.geometry.boundary.geoms
+                targets = []
+                feature_ids = []
+                for part_index, part in enumerate(row.geometry.geoms):
+                    targets.append(part.exterior)
+                    feature_ids.append(str(part_index))
+                    for ring in part.interiors:
+                        targets.append(ring)
+                        feature_ids.append(str(part_index))
             elif type(row.geometry) is shapely.geometry.polygon.Polygon:
-                targets = [row.geometry.boundary]
+                targets = [row.geometry.exterior] + list(row.geometry.interiors)
+                feature_ids = ["0"] * len(targets)
             elif type(row.geometry) is shapely.geometry.multilinestring.MultiLineString:
-                targets = row.geometry.geoms
+                targets = list(row.geometry.geoms)
+                feature_ids = [str(a) for a in range(len(targets))]
             elif type(row.geometry) is shapely.geometry.linestring.LineString:
                 targets = [row.geometry]
+                feature_ids = ["0"]
             else:
                 targets = []
-
-            # For the main cases Polygon and LineString the list 'targets' has one element
-            for a, target in enumerate(targets):
-                df2 = pandas.DataFrame(columns=schema.keys()).astype(schema)
-                distances = numpy.arange(0, target.length, self.spacing)[:-1]
-                points = [target.interpolate(distance) for distance in distances]
-                df2["X"] = [point.x for point in points]
-                df2["Y"] = [point.y for point in points]
-
-                # # account for holes//rings in polygons
-                df2["featureId"] = str(a)
-                # 1. check if line is "closed"
-                if target.is_ring:
-                    target_polygon = shapely.geometry.Polygon(target)
-                    if target_polygon.exterior.is_ccw:  # if counterclockwise --> hole
-                        for j, target2 in enumerate(targets):
-                            # skip if line or point
-                            if len(target2.coords) >= 2:
-                                continue
-                            # which poly is the hole in? assign featureId of the same poly
-                            t2_polygon = shapely.geometry.Polygon(target2)
-                            if target.within(t2_polygon):  #
-                                df2['featureId'] = str(j)
-
-                if "ID" in spatial_data.columns:
-                    df2["ID"] = row["ID"]
-                else:
-                    df2["ID"] = 0
-
-                if len(df) == 0:
-                    df = df2
-                else:
-                    df = pandas.concat([df, df2])
-
-        df.reset_index(drop=True, inplace=True)
+                feature_ids = []
+
+            row_id = row["ID"] if "ID" in spatial_data.columns else 0
+            target_list.extend(targets)
+            target_ids.extend([row_id] * len(targets))
+            target_feature_ids.extend(feature_ids)
+
+        if len(target_list) == 0:
+            return pandas.DataFrame(columns=schema.keys()).astype(schema)
+
+        # Number of samples per target matches numpy.arange(0, length, spacing)[:-1]
+        geometries = numpy.empty(len(target_list), dtype=object)
+        geometries[:] = target_list
+        lengths = shapely.length(geometries)
+        counts = numpy.maximum(numpy.ceil(lengths / self.spacing).astype(int) - 1, 0)
+
+        # Pre-allocate the per-sample distances along each target and interpolate
+        # every point in one shapely call
+        repeated_targets = numpy.repeat(geometries, counts)
+        sample_index = numpy.arange(counts.sum()) - numpy.repeat(
+            numpy.cumsum(counts) - counts, counts
+        )
+        distances = sample_index * self.spacing
+        points = shapely.line_interpolate_point(repeated_targets, distances)
+        coordinates = shapely.get_coordinates(points)
+
+        df = pandas.DataFrame(
+            {
+                "ID": numpy.repeat(numpy.array(target_ids, dtype=object), counts),
+                "X": coordinates[:, 0],
+                "Y": coordinates[:, 1],
+                "featureId": numpy.repeat(numpy.array(target_feature_ids, dtype=object), counts),
+            }
+        )
         return df
@@ -5,6 +5,48 @@ import math
 from .mapdata import MapData
 
 
+def _build_contact_graph(nx, units, contacts, map_data):
+    """
+    Build an undirected unit adjacency graph weighted by contact length
+
+    Uses the sparse contact length matrix memoized on map_data when it is available
+    so a take_best comparison of the sorter family shares one precomputed adjacency
+    structure instead of rebuilding it per sorter, and falls back to iterating the
+    contacts data frame otherwise.  Edge weights are inverted (longest contact gets
+    the smallest weight) so that minimising algorithms favour the longest contacts.
+
+    Args:
+        nx (module): the imported networkx module
+        units (pandas.DataFrame): the data frame of units (column must contain ["name"])
+        contacts (pandas.DataFrame): unit contacts with length of the contacts in metres
+        map_data (map2loop.MapData): access to the memoized contact matrix
+
+    Returns:
+        networkx.Graph: the unit adjacency graph
+    """
+    graph = nx.Graph()
+    for unit in list(units["name"].unique()):
+        graph.add_node(unit, name=unit)
+
+    matrix, unit_names = map_data.get_contact_matrix() if map_data is not None else (None, [])
+    if matrix is not None:
+        matrix = matrix.tocoo()
+        max_weight = matrix.data.max() + 1
+        for row, col, length in zip(matrix.row, matrix.col, matrix.data):
+            if row < col:
+                graph.add_edge(unit_names[row], unit_names[col], weight=int(max_weight - length))
+    else:
+        contacts = contacts.sort_values(by="length", ascending=False)[
+            ["UNITNAME_1", "UNITNAME_2", "length"]
+        ]
+        max_weight = max(list(contacts["length"])) + 1
+        for _, row in contacts.iterrows():
+            graph.add_edge(
+                row["UNITNAME_1"], row["UNITNAME_2"], weight=int(max_weight - row["length"])
+            )
+    return graph
+
+
 class Sorter(ABC):
     """
     Base Class of Sorter used to force structure of Sorter
@@ -237,18 +279,7 @@ class SorterAlpha(Sorter):
             print("Cannot import networkx module, defaulting to SorterUseHint")
             return stratigraphic_order_hint
 
-        contacts = contacts.sort_values(by="length", ascending=False)[
-            ["UNITNAME_1", "UNITNAME_2", "length"]
-        ]
-        units = list(units["name"].unique())
-        graph = nx.Graph()
-        for unit in units:
-            graph.add_node(unit, name=unit)
-        max_weight = max(list(contacts["length"])) + 1
-        for _, row in contacts.iterrows():
-            graph.add_edge(
-                row["UNITNAME_1"], row["UNITNAME_2"], weight=int(max_weight - row["length"])
-            )
+        graph = _build_contact_graph(nx, units, contacts, map_data)
 
         cnode = None
         new_graph = nx.DiGraph()
@@ -324,17 +355,7 @@ class SorterMaximiseContacts(Sorter):
             print("Cannot import networkx module, defaulting to SorterUseHint")
             return stratigraphic_order_hint
 
-        sorted_contacts = contacts.sort_values(by="length", ascending=False)
-        graph = nx.Graph()
-        units = list(units["name"].unique())
-        for unit in units:
-            graph.add_node(unit, name=unit)
-
-        max_weight = max(list(sorted_contacts["length"])) + 1
-        for _, row in sorted_contacts.iterrows():
-            graph.add_edge(
-                row["UNITNAME_1"], row["UNITNAME_2"], weight=int(max_weight - row["length"])
-            )
+        graph = _build_contact_graph(nx, units, contacts, map_data)
 
         route = nx_app.traveling_salesman_problem(graph)
         edge_list = list(nx.utils.pairwise(route))
@@ -0,0 +1,162 @@
+# external imports
+import beartype
+import contextlib
+import json
+import threading
+import time
+
+try:
+    import resource
+except ImportError:
+    # The resource module is not available on Windows; peak RSS deltas are
+    # reported as zero there
+    resource = None
+
+
+def _peak_rss_kib() -> int:
+    """
+    Get the process peak resident set size in KiB (0 where unavailable)
+
+    Returns:
+        int: The high-water mark of the process resident set size
+    """
+    if resource is None:
+        return 0
+    return int(resource.getrusage(resource.RUSAGE_SELF).ru_maxrss)
+
+
+class StageProfiler:
+    """
+    Records wall time, peak RSS growth and input sizes for pipeline stages
+
+    Each record covers one timed block (a pipeline stage or a pluggable
+    component call inside a stage; component records nest within their stage's
+    wall time).  Peak RSS is the process high-water mark, so the delta only
+    captures growth of that mark during the block and is zero when the block
+    stayed below an earlier peak.  Recording is thread safe so stages run
+    concurrently can report into the same profiler.
+
+    Attributes
+    -----------
+    records: list
+        One dict per timed block with keys "stage", "component", "seconds",
+        "peak_rss_delta_kib" and "input_rows"
+    input_rows: dict
+        The row counts of the run's input map layers, keyed by datatype name
+    """
+
+    def __init__(self):
+        """
+        The initialiser for the stage profiler
+        """
+        self.records = []
+        self.input_rows = {}
+        self._lock = threading.Lock()
+
+    def clear(self):
+        """
+        Discard all records and input sizes from previous runs
+        """
+        with self._lock:
+            self.records = []
+            self.input_rows = {}
+
+    @beartype.beartype
+    def set_input_rows(self, input_rows: dict):
+        """
+        Record the row counts of the run's input map layers
+
+        Args:
+            input_rows (dict):
+                A mapping of datatype name to number of rows
+        """
+        with self._lock:
+            self.input_rows = dict(input_rows)
+
+    @contextlib.contextmanager
+    def record(self, stage: str, component=None, input_rows=None):
+        """
+        Context manager that times the enclosed block and records the result
+
+        Args:
+            stage (str):
+                The name of the pipeline stage being timed
+            component (str, optional):
+                The label of the pluggable component running inside the stage
+                (eg. a sorter or thickness calculator label). Defaults to None.
+            input_rows (dict, optional):
+                Row counts of the inputs to this block. Defaults to None.
+        """
+        start_time = time.perf_counter()
+        start_rss = _peak_rss_kib()
+        try:
+            yield
+        finally:
+            entry = {
+                "stage": stage,
+                "component": component,
+                "seconds": time.perf_counter() - start_time,
+                "peak_rss_delta_kib": _peak_rss_kib() - start_rss,
+                "input_rows": dict(input_rows) if input_rows else {},
+            }
+            with self._lock:
+                self.records.append(entry)
+
+    def as_dict(self) -> dict:
+        """
+        Get the profiling data as a plain dictionary
+
+        Returns:
+            dict: The input sizes and the list of stage records
+        """
+        with self._lock:
+            return {"input_rows": dict(self.input_rows), "records": [dict(record) for record in self.records]}
+
+    @beartype.beartype
+    def to_json(self, filename: str = "") -> str:
+        """
+        Export the profiling data as JSON, optionally writing it to a file
+
+        Args:
+            filename (str, optional):
+                A file to write the JSON to. Defaults to "" (no file written).
+
+        Returns:
+            str: The profiling data as a JSON string
+        """
+        output = json.dumps(self.as_dict(), indent=2)
+        if filename:
+            with open(filename, "w") as file:
+                file.write(output)
+        return output
+
+    def summary(self) -> str:
+        """
+        Format the profiling data as a printable summary table
+
+        Returns:
+            str: The summary table, one row per timed block
+        """
+        data = self.as_dict()
+        lines = []
+        if data["input_rows"]:
+            counts = ", ".join(f"{name}={rows}" for name, rows in data["input_rows"].items())
+            lines.append(f"Input rows: {counts}")
+        header = f"{'stage':<40} {'component':<28} {'seconds':>10} {'rss_delta_kib':>14}  input_rows"
+        lines.append(header)
+        lines.append("-" * len(header))
+        for record in data["records"]:
+            rows = ", ".join(f"{name}={count}" for name, count in record["input_rows"].items())
+            lines.append(
+                f"{record['stage']:<40} {record['component'] or '':<28} "
+                f"{record['seconds']:>10.3f} {record['peak_rss_delta_kib']:>14}  {rows}"
+            )
+        total = sum(record["seconds"] for record in data["records"] if record["component"] is None)
+        lines.append(f"Total stage time: {total:.3f}s")
+        return "\n".join(lines)
+
+    def print_summary(self):
+        """
+        Print the summary table to the console
+        """
+        print(self.summary())
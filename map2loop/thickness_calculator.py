@@ -1,5 +1,6 @@
 # internal imports
 import scipy.interpolate
+import scipy.spatial
 from .utils import (
     create_points,
     rebuild_sampled_basal_contacts,
@@ -14,7 +15,9 @@ from .mapdata import MapData
 # external imports
 from abc import ABC, abstractmethod
 import beartype
+import concurrent.futures
 import numpy
+import os
 import scipy
 import pandas
 import geopandas
@@ -189,11 +192,18 @@ class InterpolatedStructure(ThicknessCalculator):
         -> pandas.DataFrame: Calculates a thickness map for the overall map area.
     """
 
-    def __init__(self):
+    def __init__(self, num_workers: int = 1):
         """
         Initialiser for interpolated structure version of the thickness calculator
+
+        Args:
+            num_workers (int, optional):
+                How many threads estimate unit thicknesses in parallel, as each
+                unit's estimate depends only on its own contacts and nearby
+                samples.  None uses all cores. Defaults to 1 (sequential).
         """
         self.thickness_calculator_label = "InterpolatedStructure"
+        self.num_workers = num_workers
         self.lines = []
 
     @beartype.beartype
@@ -298,83 +308,135 @@ class InterpolatedStructure(ThicknessCalculator):
             )
             return thicknesses
 
-        for i in range(0, len(stratigraphic_order) - 1):
-            if (
-                stratigraphic_order[i] in basal_unit_list
-                and stratigraphic_order[i + 1] in basal_unit_list
-            ):
-                basal_contact = contacts.loc[
-                    contacts["basal_unit"] == stratigraphic_order[i]
-                ].copy()
-                top_contact = basal_contacts.loc[
-                    basal_contacts["basal_unit"] == stratigraphic_order[i + 1]
-                ].copy()
-                top_contact_geometry = [
-                    shapely.geometry.shape(geom.__geo_interface__) for geom in top_contact.geometry
-                ]
-                if basal_contact is not None and top_contact is not None:
-                    interp_points = interpolated_orientations.loc[
-                        interpolated_orientations["UNITNAME"] == stratigraphic_order[i], "geometry"
-                    ].copy()
-                    dip = interpolated_orientations.loc[
-                        interpolated_orientations["UNITNAME"] == stratigraphic_order[i], "dip"
-                    ].to_numpy()
-                    _thickness = []
-                    for _, row in basal_contact.iterrows():
-                        # find the shortest line between the basal contact points and top contact points
-                        short_line = shapely.shortest_line(row.geometry, top_contact_geometry)
-                        self.lines.append(short_line)
-                        # extract the end points of the shortest line
-                        p1 = numpy.zeros(3)
-                        p1[0] = numpy.asarray(short_line[0].coords[0][0])
-                        p1[1] = numpy.asarray(short_line[0].coords[0][1])
-                        # get the elevation Z of the end point p1
-                        p1[2] = map_data.get_value_from_raster(Datatype.DTM, p1[0], p1[1])
-                        # create array to store xyz coordinates of the end point p2
-                        p2 = numpy.zeros(3)
-                        p2[0] = numpy.asarray(short_line[0].coords[-1][0])
-                        p2[1] = numpy.asarray(short_line[0].coords[-1][1])
-                        # get the elevation Z of the end point p2
-                        p2[2] = map_data.get_value_from_raster(Datatype.DTM, p2[0], p2[1])
-                        # get the elevation Z of the end point p2
-                        p2[2] = map_data.get_value_from_raster(Datatype.DTM, p2[0], p2[1])
-                        # calculate the length of the shortest line
-                        line_length = scipy.spatial.distance.euclidean(p1, p2)
-                        # find the indices of the points that are within 5% of the length of the shortest line
-                        indices = shapely.dwithin(short_line, interp_points, line_length * 0.25)
-                        # get the dip of the points that are within
-                        # 10% of the length of the shortest line
-                        _dip = numpy.deg2rad(dip[indices])
-                        # get the end points of the shortest line
-                        # calculate the true thickness t = L . sin dip
-                        thickness = line_length * numpy.sin(_dip)
-                        # Average thickness along the shortest line
-                        if all(numpy.isnan(thickness)):
-                            pass
-                        else:
-                            _thickness.append(numpy.nanmean(thickness))
-
-                    # calculate the median thickness and standard deviation for the unit
-                    _thickness = numpy.asarray(_thickness, dtype=numpy.float64)
-
-                    median = numpy.nanmedian(_thickness)
-                    mean = numpy.nanmean(_thickness)
-                    std_dev = numpy.nanstd(_thickness, dtype=numpy.float64)
-
-                    idx = thicknesses.index[
-                        thicknesses["name"] == stratigraphic_order[i + 1]
-                    ].tolist()[0]
-                    thicknesses.loc[idx, "ThicknessMean"] = mean
-                    thicknesses.loc[idx, "ThicknessMedian"] = median
-                    thicknesses.loc[idx, "ThicknessStdDev"] = std_dev
+        def unit_thickness(i):
+            return self._compute_unit_thickness(
+                i,
+                stratigraphic_order,
+                basal_unit_list,
+                contacts,
+                basal_contacts,
+                interpolated_orientations,
+                map_data,
+            )
 
-            else:
-                print(
-                    f"Cannot calculate thickness between {stratigraphic_order[i]} and {stratigraphic_order[i + 1]}"
+        # Each unit's estimate only depends on its own contacts and nearby samples
+        # so the units can be farmed out to parallel workers
+        if self.num_workers is None or self.num_workers > 1:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=self.num_workers) as pool:
+                unit_results = list(
+                    pool.map(unit_thickness, range(0, len(stratigraphic_order) - 1))
                 )
+        else:
+            unit_results = [unit_thickness(i) for i in range(0, len(stratigraphic_order) - 1)]
+
+        for result in unit_results:
+            if result is None:
+                continue
+            unit_name, mean, median, std_dev = result
+            idx = thicknesses.index[thicknesses["name"] == unit_name].tolist()[0]
+            thicknesses.loc[idx, "ThicknessMean"] = mean
+            thicknesses.loc[idx, "ThicknessMedian"] = median
+            thicknesses.loc[idx, "ThicknessStdDev"] = std_dev
 
         return thicknesses
 
+    def _compute_unit_thickness(
+        self,
+        i,
+        stratigraphic_order,
+        basal_unit_list,
+        contacts,
+        basal_contacts,
+        interpolated_orientations,
+        map_data,
+    ):
+        """
+        Estimate the thickness of the unit above stratigraphic_order[i]
+
+        Args:
+            i (int): the position of the unit's basal contact in the stratigraphic order
+            stratigraphic_order (list): a list of unit names sorted from youngest to oldest
+            basal_unit_list (list): the units that have basal contacts
+            contacts (geopandas.GeoDataFrame): the sampled contact points
+            basal_contacts (geopandas.GeoDataFrame): the buffered basal contact lines
+            interpolated_orientations (geopandas.GeoDataFrame): the interpolated dips with unit names
+            map_data (map2loop.MapData): a catchall so that access to all map data is available
+
+        Returns:
+            tuple or None: (unit name, mean, median, standard deviation) of the unit
+            thickness, or None if it could not be calculated
+        """
+
+        if (
+            stratigraphic_order[i] in basal_unit_list
+            and stratigraphic_order[i + 1] in basal_unit_list
+        ):
+            basal_contact = contacts.loc[
+                contacts["basal_unit"] == stratigraphic_order[i]
+            ].copy()
+            top_contact = basal_contacts.loc[
+                basal_contacts["basal_unit"] == stratigraphic_order[i + 1]
+            ].copy()
+            top_contact_geometry = [
+                shapely.geometry.shape(geom.__geo_interface__) for geom in top_contact.geometry
+            ]
+            if basal_contact is not None and top_contact is not None:
+                interp_points = interpolated_orientations.loc[
+                    interpolated_orientations["UNITNAME"] == stratigraphic_order[i], "geometry"
+                ].copy()
+                dip = interpolated_orientations.loc[
+                    interpolated_orientations["UNITNAME"] == stratigraphic_order[i], "dip"
+                ].to_numpy()
+                _thickness = []
+                for _, row in basal_contact.iterrows():
+                    # find the shortest line between the basal contact points and top contact points
+                    short_line = shapely.shortest_line(row.geometry, top_contact_geometry)
+                    self.lines.append(short_line)
+                    # extract the end points of the shortest line
+                    p1 = numpy.zeros(3)
+                    p1[0] = numpy.asarray(short_line[0].coords[0][0])
+                    p1[1] = numpy.asarray(short_line[0].coords[0][1])
+                    # get the elevation Z of the end point p1
+                    p1[2] = map_data.get_value_from_raster(Datatype.DTM, p1[0], p1[1])
+                    # create array to store xyz coordinates of the end point p2
+                    p2 = numpy.zeros(3)
+                    p2[0] = numpy.asarray(short_line[0].coords[-1][0])
+                    p2[1] = numpy.asarray(short_line[0].coords[-1][1])
+                    # get the elevation Z of the end point p2
+                    p2[2] = map_data.get_value_from_raster(Datatype.DTM, p2[0], p2[1])
+                    # get the elevation Z of the end point p2
+                    p2[2] = map_data.get_value_from_raster(Datatype.DTM, p2[0], p2[1])
+                    # calculate the length of the shortest line
+                    line_length = scipy.spatial.distance.euclidean(p1, p2)
+                    # find the indices of the points that are within 5% of the length of the shortest line
+                    indices = shapely.dwithin(short_line, interp_points, line_length * 0.25)
+                    # get the dip of the points that are within
+                    # 10% of the length of the shortest line
+                    _dip = numpy.deg2rad(dip[indices])
+                    # get the end points of the shortest line
+                    # calculate the true thickness t = L . sin dip
+                    thickness = line_length * numpy.sin(_dip)
+                    # Average thickness along the shortest line
+                    if all(numpy.isnan(thickness)):
+                        pass
+                    else:
+                        _thickness.append(numpy.nanmean(thickness))
+
+                # calculate the median thickness and standard deviation for the unit
+                _thickness = numpy.asarray(_thickness, dtype=numpy.float64)
+
+                median = numpy.nanmedian(_thickness)
+                mean = numpy.nanmean(_thickness)
+                std_dev = numpy.nanstd(_thickness, dtype=numpy.float64)
+
+                return (stratigraphic_order[i + 1], mean, median, std_dev)
+
+        else:
+            print(
+                f"Cannot calculate thickness between {stratigraphic_order[i]} and {stratigraphic_order[i + 1]}"
+            )
+        return None
+
 
 class StructuralPoint(ThicknessCalculator):
     '''
@@ -390,10 +452,29 @@ class StructuralPoint(ThicknessCalculator):
 
     '''
 
-    def __init__(self):
-        self.sorter_label = "StructuralPoint"
+    @beartype.beartype
+    def __init__(self, use_kdtree: bool = False, num_workers: int = 1):
+        """
+        Initialiser for the structural point thickness calculator
+
+        Args:
+            num_workers (int, optional):
+                How many threads process structural measurements in parallel in
+                the per-measurement mode, as each measurement is independent.
+                None uses all cores. Defaults to 1 (sequential).
+            use_kdtree (bool, optional):
+                Use the bulk nearest-contact mode which loads the contact vertices of
+                the units bounding each stratigraphic unit into a scipy.spatial.cKDTree
+                once per unit, answers all nearest-segment queries in a single query
+                call and runs the strike check and thickness trigonometry as vectorized
+                numpy over the whole batch. Defaults to False (the per-measurement
+                perpendicular line intersection workflow).
+        """
+        self.thickness_calculator_label = "StructuralPoint"
         self.line_length = 10000
         self.strike_allowance = 30
+        self.use_kdtree = use_kdtree
+        self.num_workers = num_workers
 
     @beartype.beartype
     def compute(
@@ -464,6 +545,138 @@ class StructuralPoint(ThicknessCalculator):
         map_dx = geology.total_bounds[2] - geology.total_bounds[0]
         map_dy = geology.total_bounds[3] - geology.total_bounds[1]
 
+        if self.use_kdtree:
+            result = self._compute_thickness_kdtree(
+                sampled_structures, sampled_basal_contacts, stratigraphic_order, map_dx, map_dy
+            )
+        else:
+            result = self._compute_thickness_intersections(
+                sampled_structures, sampled_basal_contacts, basal_contacts, geology, map_dx, map_dy
+            )
+
+        output_units = units.copy()
+        # remove the old thickness column
+        output_units['ThicknessMedian'] = numpy.empty((len(output_units)))
+        output_units['ThicknessMean'] = numpy.empty((len(output_units)))
+        output_units['ThicknessStdDev'] = numpy.empty((len(output_units)))
+
+        # find which units have no thickness calculated
+        names_not_in_result = units[~units['name'].isin(result['unit'])]['name'].to_list()
+        # assign the thicknesses to the each unit
+        for _, unit in result.iterrows():
+            idx = units.index[units['name'] == unit['unit']].tolist()[0]
+            output_units.loc[idx, 'ThicknessMedian'] = unit['median']
+            output_units.loc[idx, 'ThicknessMean'] = unit['mean']
+            output_units.loc[idx, 'ThicknessStdDev'] = unit['std']
+        # handle the units that have no thickness
+        for unit in names_not_in_result:
+            # if no thickness has been calculated for the unit
+            if (
+                # not a top//bottom unit
+                (output_units[output_units['name'] == unit]['ThicknessMedian'].all() == 0)
+                and (unit != stratigraphic_order[-1])
+                and (unit != stratigraphic_order[0])
+            ):
+                idx = stratigraphic_order.index(unit)
+                # throw warning to user
+                print(
+                    'It was not possible to calculate thickness between unit ',
+                    unit,
+                    "and ",
+                    stratigraphic_order[idx + 1],
+                    'Assigning thickness of -1',
+                )
+                # assign -1 as thickness
+                output_units.loc[output_units["name"] == unit, "ThicknessMedian"] = -1
+                output_units.loc[output_units["name"] == unit, "ThicknessMean"] = -1
+                output_units.loc[output_units["name"] == unit, "ThicknessStdDev"] = -1
+
+            # if top//bottom unit assign -1
+            if unit == stratigraphic_order[-1] or unit == stratigraphic_order[0]:
+                output_units.loc[output_units["name"] == unit, "ThicknessMedian"] = -1
+                output_units.loc[output_units["name"] == unit, "ThicknessMean"] = -1
+                output_units.loc[output_units["name"] == unit, "ThicknessStdDev"] = -1
+
+        return output_units
+
+    @beartype.beartype
+    def _compute_thickness_intersections(
+        self,
+        sampled_structures: geopandas.GeoDataFrame,
+        sampled_basal_contacts: geopandas.GeoDataFrame,
+        basal_contacts: geopandas.GeoDataFrame,
+        geology: geopandas.GeoDataFrame,
+        map_dx: float,
+        map_dy: float,
+    ) -> pandas.DataFrame:
+        """
+        Calculate per unit thickness statistics with the per-measurement workflow
+
+        For each stratigraphic measurement a line perpendicular to its strike is
+        intersected with the sampled basal contacts and the checks described in
+        compute are applied before the thickness is calculated from the
+        intersection separation and the measured dip.
+
+        Args:
+            sampled_structures (geopandas.GeoDataFrame): sampled structural measurements with unit names
+            sampled_basal_contacts (geopandas.GeoDataFrame): basal contact lines rebuilt from the sampled contacts
+            basal_contacts (geopandas.GeoDataFrame): the basal contact geo data
+            geology (geopandas.GeoDataFrame): the geology polygons with per unit bounding boxes
+            map_dx (float): the map width used to reject spurious intersections
+            map_dy (float): the map height used to reject spurious intersections
+
+        Returns:
+            pandas.DataFrame: thickness statistics with columns ["unit", "median", "mean", "std"]
+        """
+        # Each measurement is independent so they can be processed in
+        # parallel chunks when more than one worker is requested
+        if self.num_workers is None or self.num_workers > 1:
+            num_workers = self.num_workers or (os.cpu_count() or 1)
+            chunks = numpy.array_split(numpy.arange(len(sampled_structures)), num_workers)
+            with concurrent.futures.ThreadPoolExecutor(max_workers=num_workers) as pool:
+                chunk_results = list(
+                    pool.map(
+                        lambda chunk: self._measure_structures(
+                            sampled_structures.iloc[chunk],
+                            sampled_basal_contacts,
+                            basal_contacts,
+                            geology,
+                            map_dx,
+                            map_dy,
+                        ),
+                        [chunk for chunk in chunks if len(chunk) > 0],
+                    )
+                )
+            thicknesses = [t for chunk_thicknesses, _ in chunk_results for t in chunk_thicknesses]
+            lis = [unit for _, chunk_lis in chunk_results for unit in chunk_lis]
+        else:
+            thicknesses, lis = self._measure_structures(
+                sampled_structures, sampled_basal_contacts, basal_contacts, geology, map_dx, map_dy
+            )
+
+        # create a DataFrame of the thicknesses median and standard deviation by lithology
+        result = pandas.DataFrame({'unit': lis, 'thickness': thicknesses})
+        result = result.groupby('unit')['thickness'].agg(['median', 'mean', 'std']).reset_index()
+        result.rename(columns={'thickness': 'ThicknessMedian'}, inplace=True)
+        return result
+
+    def _measure_structures(
+        self, sampled_structures, sampled_basal_contacts, basal_contacts, geology, map_dx, map_dy
+    ):
+        """
+        Run the per-measurement intersection workflow over a set of measurements
+
+        Args:
+            sampled_structures (geopandas.GeoDataFrame): the structural measurements to process
+            sampled_basal_contacts (geopandas.GeoDataFrame): basal contact lines rebuilt from the sampled contacts
+            basal_contacts (geopandas.GeoDataFrame): the basal contact geo data
+            geology (geopandas.GeoDataFrame): the geology polygons with per unit bounding boxes
+            map_dx (float): the map width used to reject spurious intersections
+            map_dy (float): the map height used to reject spurious intersections
+
+        Returns:
+            tuple: (list of thicknesses, list of lithologies) for the measurements that passed the checks
+        """
         # create empty lists to store thicknesses and lithologies
         thicknesses = []
         lis = []
@@ -567,53 +780,94 @@ class StructuralPoint(ThicknessCalculator):
 
             thicknesses.append(thickness)
             lis.append(litho_in)
+        return thicknesses, lis
 
-        # create a DataFrame of the thicknesses median and standard deviation by lithology
-        result = pandas.DataFrame({'unit': lis, 'thickness': thicknesses})
-        result = result.groupby('unit')['thickness'].agg(['median', 'mean', 'std']).reset_index()
-        result.rename(columns={'thickness': 'ThicknessMedian'}, inplace=True)
+    @beartype.beartype
+    def _compute_thickness_kdtree(
+        self,
+        sampled_structures: geopandas.GeoDataFrame,
+        sampled_basal_contacts: geopandas.GeoDataFrame,
+        stratigraphic_order: list,
+        map_dx: float,
+        map_dy: float,
+    ) -> pandas.DataFrame:
+        """
+        Calculate per unit thickness statistics with bulk nearest-contact queries
+
+        The vertices of the sampled basal contacts bounding each stratigraphic unit
+        are loaded into a scipy.spatial.cKDTree once per unit and the nearest
+        contact vertex for all of that unit's measurements is found in a single
+        query call. The unit thickness at a measurement is approximated by the sum
+        of the distances to the two bounding contacts which matches the
+        perpendicular line construction of the default mode when the measurement
+        strike follows the contacts. The strike allowance check compares the
+        measurement strike against the contact segment strike at the nearest
+        vertex (modulo 180 as a contact strike has no polarity) and the
+        trigonometry runs as vectorized numpy over the whole batch.
 
-        output_units = units.copy()
-        # remove the old thickness column
-        output_units['ThicknessMedian'] = numpy.empty((len(output_units)))
-        output_units['ThicknessMean'] = numpy.empty((len(output_units)))
-        output_units['ThicknessStdDev'] = numpy.empty((len(output_units)))
+        Args:
+            sampled_structures (geopandas.GeoDataFrame): sampled structural measurements with unit names
+            sampled_basal_contacts (geopandas.GeoDataFrame): basal contact lines rebuilt from the sampled contacts
+            stratigraphic_order (list): a list of unit names sorted from youngest to oldest
+            map_dx (float): the map width used to reject spurious matches
+            map_dy (float): the map height used to reject spurious matches
 
-        # find which units have no thickness calculated
-        names_not_in_result = units[~units['name'].isin(result['unit'])]['name'].to_list()
-        # assign the thicknesses to the each unit
-        for _, unit in result.iterrows():
-            idx = units.index[units['name'] == unit['unit']].tolist()[0]
-            output_units.loc[idx, 'ThicknessMedian'] = unit['median']
-            output_units.loc[idx, 'ThicknessMean'] = unit['mean']
-            output_units.loc[idx, 'ThicknessStdDev'] = unit['std']
-        # handle the units that have no thickness
-        for unit in names_not_in_result:
-            # if no thickness has been calculated for the unit
-            if (
-                # not a top//bottom unit
-                (output_units[output_units['name'] == unit]['ThicknessMedian'].all() == 0)
-                and (unit != stratigraphic_order[-1])
-                and (unit != stratigraphic_order[0])
-            ):
-                idx = stratigraphic_order.index(unit)
-                # throw warning to user
-                print(
-                    'It was not possible to calculate thickness between unit ',
-                    unit,
-                    "and ",
-                    stratigraphic_order[idx + 1],
-                    'Assigning thickness of -1',
-                )
-                # assign -1 as thickness
-                output_units.loc[output_units["name"] == unit, "ThicknessMedian"] = -1
-                output_units.loc[output_units["name"] == unit, "ThicknessMean"] = -1
-                output_units.loc[output_units["name"] == unit, "ThicknessStdDev"] = -1
+        Returns:
+            pandas.DataFrame: thickness statistics with columns ["unit", "median", "mean", "std"]
+        """
+        # extract the contact vertices and the strike of the segment at each vertex once
+        contact_trees = {}
+        contact_strikes = {}
+        for _, row in sampled_basal_contacts.iterrows():
+            coordinates = shapely.get_coordinates(row.geometry)
+            if len(coordinates) < 2:
+                continue
+            deltas = numpy.diff(coordinates, axis=0)
+            segment_strikes = numpy.degrees(numpy.arctan2(deltas[:, 0], deltas[:, 1])) % 360
+            contact_trees[row['basal_unit']] = scipy.spatial.cKDTree(coordinates)
+            # the last vertex takes the strike of the segment leading into it
+            contact_strikes[row['basal_unit']] = numpy.append(segment_strikes, segment_strikes[-1])
 
-            # if top//bottom unit assign -1
-            if unit == stratigraphic_order[-1] or unit == stratigraphic_order[0]:
-                output_units.loc[output_units["name"] == unit, "ThicknessMedian"] = -1
-                output_units.loc[output_units["name"] == unit, "ThicknessMean"] = -1
-                output_units.loc[output_units["name"] == unit, "ThicknessStdDev"] = -1
+        results = {'unit': [], 'median': [], 'mean': [], 'std': []}
+        for i in range(0, len(stratigraphic_order) - 1):
+            unit = stratigraphic_order[i]
+            unit_above = stratigraphic_order[i + 1]
+            if unit not in contact_trees or unit_above not in contact_trees:
+                continue
+            measurements = sampled_structures[sampled_structures['unit_name'] == unit]
+            if len(measurements) == 0:
+                continue
 
-        return output_units
+            # answer the nearest contact vertex queries for the whole unit in one call
+            xy = measurements[['X', 'Y']].to_numpy(dtype=numpy.float64)
+            distance1, index1 = contact_trees[unit].query(xy)
+            distance2, index2 = contact_trees[unit_above].query(xy)
+
+            # check the measurement strike follows both bounding contacts
+            strike = (measurements['DIPDIR'].to_numpy(dtype=numpy.float64) - 90) % 360
+            deviation1 = numpy.abs((strike - contact_strikes[unit][index1] + 90) % 180 - 90)
+            deviation2 = numpy.abs((strike - contact_strikes[unit_above][index2] + 90) % 180 - 90)
+
+            # if the contacts are too far apart, skip
+            lengths = distance1 + distance2
+            mask = (
+                (deviation1 <= self.strike_allowance)
+                & (deviation2 <= self.strike_allowance)
+                & (lengths <= map_dx / 2)
+                & (lengths <= map_dy / 2)
+            )
+            if not mask.any():
+                continue
+
+            # calculate thickness with the general formula L*sin(dip)
+            dip = numpy.deg2rad(measurements['DIP'].to_numpy(dtype=numpy.float64)[mask])
+            unit_thicknesses = lengths[mask] * numpy.sin(dip)
+            unit_thicknesses = unit_thicknesses[~numpy.isnan(unit_thicknesses)]
+            if len(unit_thicknesses) == 0:
+                continue
+            results['unit'].append(unit)
+            results['median'].append(numpy.median(unit_thicknesses))
+            results['mean'].append(numpy.mean(unit_thicknesses))
+            results['std'].append(numpy.std(unit_thicknesses))
+
+        return pandas.DataFrame(results)
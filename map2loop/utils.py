@@ -256,51 +256,72 @@ def rebuild_sampled_basal_contacts(
         MultiLineString geometries, rebuilt from the sampled_contacts.
     """
 
-    sampled_geology = geopandas.GeoDataFrame(
-        sampled_contacts,
-        geometry=geopandas.points_from_xy(sampled_contacts.X, sampled_contacts.Y),
-        crs=basal_contacts.crs,
-    )
-
-    basal_contacts['geometry'] = basal_contacts.buffer(1)
-    sampled_basal_contacts = sampled_geology.sjoin(
-        basal_contacts, how='left', predicate='intersects'
-    ).dropna()
-
-    r = []
-
-    for basal_u in sampled_basal_contacts['basal_unit'].unique():
-
-        subset = sampled_basal_contacts[sampled_basal_contacts['basal_unit'] == basal_u]
-        unique_segments = subset['featureId'].unique()
-
-        if len(unique_segments) == 1:
-            # make a linestring with all the points in subset
-            line = shapely.LineString(subset.geometry)
-            r.append(line)
-
-        else:
-            lines = []
-            # Process each segment number
-            for featureId in unique_segments:
-                seg_subset = subset[subset['featureId'] == featureId]
-                if len(seg_subset) > 1:  # Ensure each segment has at least two points
-                    line_ = shapely.LineString(seg_subset.geometry.tolist())
-                    lines.append(line_)
-
-            # If multiple lines were created, combine them into a MultiLineString
-            if lines:
-                line = shapely.MultiLineString(lines)
-                r.append(line)
-
-    sampled_basal_contacts = geopandas.GeoDataFrame(
-        sampled_basal_contacts['basal_unit'].unique(),
-        geometry=r,
-        crs=basal_contacts.crs,
-        columns=['basal_unit'],
+    # Label each sampled point with its basal unit.  Points sampled by
+    # SamplerSpacing already carry the 'ID' of their source contact, so they can
+    # be matched back directly; the 1m buffer spatial join is only the fallback
+    # for point sets without that column
+    if 'ID' in sampled_contacts.columns and 'ID' in basal_contacts.columns:
+        id_to_unit = dict(zip(basal_contacts['ID'], basal_contacts['basal_unit']))
+        labelled = sampled_contacts[['X', 'Y', 'featureId']].copy()
+        labelled['basal_unit'] = sampled_contacts['ID'].map(id_to_unit)
+        labelled = labelled.dropna(subset=['basal_unit'])
+    else:
+        sampled_geology = geopandas.GeoDataFrame(
+            sampled_contacts,
+            geometry=geopandas.points_from_xy(sampled_contacts.X, sampled_contacts.Y),
+            crs=basal_contacts.crs,
+        )
+        buffered = basal_contacts.copy()
+        buffered['geometry'] = buffered.buffer(1)
+        labelled = sampled_geology.sjoin(buffered, how='left', predicate='intersects').dropna()
+
+    if len(labelled) == 0:
+        return geopandas.GeoDataFrame(
+            {'basal_unit': []}, geometry=[], crs=basal_contacts.crs
+        )
+
+    # Group the points into (basal unit, segment) runs, keeping the unit order of
+    # first appearance and the along-contact point order within each segment
+    unit_codes, unit_names = pandas.factorize(labelled['basal_unit'])
+    feature_codes = pandas.factorize(labelled['featureId'])[0]
+    segment_codes = unit_codes.astype(numpy.int64) * (feature_codes.max() + 1) + feature_codes
+    order = numpy.argsort(segment_codes, kind='stable')
+    segment_codes = segment_codes[order]
+    unit_codes = unit_codes[order]
+    coordinates = numpy.column_stack(
+        [labelled['X'].to_numpy(dtype=float), labelled['Y'].to_numpy(dtype=float)]
+    )[order]
+
+    # Drop segments with fewer than the two points a LineString needs, then build
+    # every segment in one bulk shapely call from the contiguous coordinate runs
+    _, segment_indices, counts = numpy.unique(
+        segment_codes, return_inverse=True, return_counts=True
     )
-
-    return sampled_basal_contacts
+    keep = counts[segment_indices] >= 2
+    coordinates = coordinates[keep]
+    unit_codes = unit_codes[keep]
+    segment_indices = numpy.unique(segment_indices[keep], return_inverse=True)[1]
+    if len(coordinates) == 0:
+        return geopandas.GeoDataFrame(
+            {'basal_unit': []}, geometry=[], crs=basal_contacts.crs
+        )
+    lines = shapely.linestrings(coordinates, indices=segment_indices)
+    segment_starts = numpy.flatnonzero(numpy.r_[True, numpy.diff(segment_indices) != 0])
+    segment_units = unit_codes[segment_starts]
+
+    # Combine each unit's segments, multiline when a contact came in several parts
+    names = []
+    geometry = []
+    for code in range(len(unit_names)):
+        segments = lines[segment_units == code]
+        if len(segments) == 0:
+            continue
+        names.append(unit_names[code])
+        geometry.append(
+            segments[0] if len(segments) == 1 else shapely.MultiLineString(list(segments))
+        )
+
+    return geopandas.GeoDataFrame({'basal_unit': names}, geometry=geometry, crs=basal_contacts.crs)
 
 
 @beartype.beartype
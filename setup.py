@@ -42,6 +42,10 @@ setuptools.setup(
         "map2model",
         "beartype",
     ],
+    extras_require={
+        "benchmark": ["pytest", "pytest-benchmark"],
+        "checkpoint": ["pyarrow"],
+    },
     url="https://github.com/Loop3D/map2loop",
     packages=setuptools.find_packages(),
     include_package_data=True,
@@ -0,0 +1,55 @@
+# Tests the on-disk cache used for remote WFS/tif retrievals
+
+# internal imports
+from map2loop.download_cache import DownloadCache
+
+# external imports
+import os
+import time
+
+url = "https://example.com/geology?service=WFS"
+bounding_box_str = "0,0,1000,1000"
+projection = "EPSG:28350"
+
+
+def test_put_then_get_roundtrip(tmp_path):
+    cache = DownloadCache(cache_dir=str(tmp_path))
+    filename = cache.put(url, b"payload", bounding_box_str, projection)
+    hit = cache.get(url, bounding_box_str, projection)
+    assert hit == filename, "Cached entry was not found on lookup"
+    with open(hit, "rb") as file:
+        assert file.read() == b"payload", "Cached entry does not hold the stored response"
+
+
+def test_key_includes_bounding_box_and_projection(tmp_path):
+    cache = DownloadCache(cache_dir=str(tmp_path))
+    cache.put(url, b"payload", bounding_box_str, projection)
+    assert (
+        cache.get(url, "0,0,500,500", projection) is None
+    ), "A different bounding box should miss the cache"
+    assert (
+        cache.get(url, bounding_box_str, "EPSG:7854") is None
+    ), "A different projection should miss the cache"
+
+
+def test_expired_entries_miss_and_are_removed(tmp_path):
+    cache = DownloadCache(cache_dir=str(tmp_path), ttl_seconds=5.0)
+    filename = cache.put(url, b"payload", bounding_box_str, projection)
+    stale = time.time() - 10.0
+    os.utime(filename, (stale, stale))
+    assert cache.get(url, bounding_box_str, projection) is None, "Expired entry was served"
+    assert not os.path.isfile(filename), "Expired entry was not removed"
+
+
+def test_prune_drops_oldest_entries_over_size_limit(tmp_path):
+    cache = DownloadCache(cache_dir=str(tmp_path), size_limit_bytes=10)
+    old_filename = cache.put("https://example.com/old", b"12345678", bounding_box_str, projection)
+    stale = time.time() - 10.0
+    os.utime(old_filename, (stale, stale))
+    cache.put("https://example.com/new", b"12345678", bounding_box_str, projection)
+    assert (
+        cache.get("https://example.com/old", bounding_box_str, projection) is None
+    ), "Oldest entry should be pruned once the cache exceeds its size limit"
+    assert (
+        cache.get("https://example.com/new", bounding_box_str, projection) is not None
+    ), "Newest entry should survive pruning"
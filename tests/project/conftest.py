@@ -0,0 +1,64 @@
+# Shared fixtures building a small synthetic MapData so project level features
+# (clipped views, batches, checkpoints) can be tested without files or servers
+
+# internal imports
+from map2loop.mapdata import MapData
+from map2loop.project import Project
+from map2loop.m2l_enums import Datatype, Datastate, VerboseLevel
+
+# external imports
+import pytest
+import geopandas
+import shapely
+
+bounding_box = {
+    "minx": 0,
+    "miny": 0,
+    "maxx": 1000,
+    "maxy": 1000,
+    "base": -1000,
+    "top": 0,
+}
+
+
+def build_synthetic_map_data():
+    """
+    Build a MapData holding a two unit parsed geology layer, as if it had been
+    loaded, reprojected, clipped and parsed from file
+    """
+    map_data = MapData(verbose_level=VerboseLevel.NONE)
+    map_data.set_working_projection("EPSG:28350")
+    map_data.set_bounding_box(bounding_box)
+    geology = geopandas.GeoDataFrame(
+        {
+            "UNITNAME": ["unit_a", "unit_b"],
+            "ID": [0, 1],
+            "GROUP": ["group_a", "group_a"],
+            "SUPERGROUP": ["supergroup_a", "supergroup_a"],
+            "MIN_AGE": [0.0, 100.0],
+            "MAX_AGE": [100.0, 200.0],
+            "INTRUSIVE": [False, False],
+            "SILL": [False, False],
+            "geometry": [
+                shapely.box(0, 0, 400, 1000),
+                shapely.box(400, 0, 1000, 1000),
+            ],
+        },
+        crs="EPSG:28350",
+    )
+    map_data.data[Datatype.GEOLOGY] = geology
+    map_data.data_states[Datatype.GEOLOGY] = Datastate.COMPLETE
+    map_data.dirtyflags[Datatype.GEOLOGY] = False
+    return map_data
+
+
+@pytest.fixture
+def synthetic_map_data():
+    return build_synthetic_map_data()
+
+
+@pytest.fixture
+def synthetic_project(synthetic_map_data):
+    return Project.from_mapdata(
+        synthetic_map_data, bounding_box, verbose_level=VerboseLevel.NONE
+    )
@@ -0,0 +1,50 @@
+# Tests the checkpoint save/load roundtrip used for pipeline resume
+
+# internal imports
+from map2loop.project import Project
+from map2loop.m2l_enums import VerboseLevel
+
+# external imports
+import pandas
+import pytest
+
+pytest.importorskip("pyarrow", reason="checkpointing stores tables as parquet/feather")
+
+bounding_box = {
+    "minx": 0,
+    "miny": 0,
+    "maxx": 1000,
+    "maxy": 1000,
+    "base": -1000,
+    "top": 0,
+}
+
+
+def test_checkpoint_roundtrip(synthetic_project, synthetic_map_data, tmp_path):
+    checkpoint_path = str(tmp_path / "checkpoint")
+    synthetic_project.geology_samples = pandas.DataFrame(
+        {"ID": [0], "X": [10.0], "Y": [20.0], "Z": [30.0], "featureId": ["0"]}
+    )
+    synthetic_project.stratigraphic_column.column = ["unit_b", "unit_a"]
+    synthetic_project._record_stage("sample_GEOLOGY", "fingerprint")
+    synthetic_project.save_checkpoint(checkpoint_path)
+
+    restored = Project.from_mapdata(
+        synthetic_map_data, bounding_box, verbose_level=VerboseLevel.NONE
+    )
+    restored.load_checkpoint(checkpoint_path)
+    assert restored.stratigraphic_column.column == [
+        "unit_b",
+        "unit_a",
+    ], "Stratigraphic column was not restored from the checkpoint"
+    assert (
+        restored._stage_fingerprints.get("sample_GEOLOGY") == "fingerprint"
+    ), "Stage fingerprints were not restored, so resume would re-run everything"
+    assert restored.geology_samples["X"].tolist() == [
+        10.0
+    ], "Sampled geology points were not restored from the checkpoint"
+
+
+def test_checkpoint_support_check_passes_with_pyarrow():
+    # With pyarrow importable the guard must not raise
+    Project._check_checkpoint_support()
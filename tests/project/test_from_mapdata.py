@@ -0,0 +1,64 @@
+# Tests that Project.from_mapdata builds a working project over a sub-region
+# of an already loaded MapData without re-running the load and parse steps
+
+# internal imports
+from map2loop.project import Project
+from map2loop.m2l_enums import Datatype, Datastate, VerboseLevel
+
+tile_bounding_box = {
+    "minx": 0,
+    "miny": 0,
+    "maxx": 500,
+    "maxy": 1000,
+    "base": -1000,
+    "top": 0,
+}
+
+
+def test_from_mapdata_clips_geology_to_tile(synthetic_map_data):
+    project = Project.from_mapdata(
+        synthetic_map_data, tile_bounding_box, verbose_level=VerboseLevel.NONE
+    )
+    geology = project.map_data.get_map_data(Datatype.GEOLOGY)
+    assert geology is not None, "from_mapdata project has no geology view"
+    assert (
+        geology.total_bounds[2] <= tile_bounding_box["maxx"]
+    ), "Geology view was not clipped to the tile bounding box"
+    assert set(geology["UNITNAME"]) == {
+        "unit_a",
+        "unit_b",
+    }, "Units crossing the tile boundary were lost in the clip"
+
+
+def test_from_mapdata_marks_views_complete(synthetic_map_data):
+    project = Project.from_mapdata(
+        synthetic_map_data, tile_bounding_box, verbose_level=VerboseLevel.NONE
+    )
+    assert (
+        project.map_data.data_states[Datatype.GEOLOGY] == Datastate.COMPLETE
+    ), "Clipped geology view is not marked COMPLETE"
+    assert (
+        project.map_data.dirtyflags[Datatype.GEOLOGY] is False
+    ), "Clipped geology view is still flagged dirty"
+
+
+def test_from_mapdata_populates_stratigraphic_column(synthetic_map_data):
+    project = Project.from_mapdata(
+        synthetic_map_data, tile_bounding_box, verbose_level=VerboseLevel.NONE
+    )
+    assert set(project.stratigraphic_column.stratigraphicUnits["name"]) == {
+        "unit_a",
+        "unit_b",
+    }, "Stratigraphic column was not populated from the clipped geology"
+
+
+def test_from_mapdata_shares_config_and_cache(synthetic_map_data):
+    project = Project.from_mapdata(
+        synthetic_map_data, tile_bounding_box, verbose_level=VerboseLevel.NONE
+    )
+    assert (
+        project.map_data.config is synthetic_map_data.config
+    ), "Config is copied rather than shared by reference"
+    assert (
+        project.map_data.download_cache is synthetic_map_data.download_cache
+    ), "Download cache is copied rather than shared by reference"
@@ -0,0 +1,49 @@
+# Tests the stage dependency scheduler behind Project.run_all(parallel=True)
+
+# external imports
+import pytest
+import threading
+
+
+def test_stages_run_once_and_respect_dependencies(synthetic_project):
+    order = []
+    lock = threading.Lock()
+
+    def stage(name):
+        def run():
+            with lock:
+                order.append(name)
+
+        return run
+
+    synthetic_project._run_stages_concurrently(
+        {
+            "a": (stage("a"), []),
+            "b": (stage("b"), ["a"]),
+            "c": (stage("c"), ["a"]),
+            "d": (stage("d"), ["b", "c"]),
+        }
+    )
+    assert sorted(order) == ["a", "b", "c", "d"], "Each stage should run exactly once"
+    assert order.index("a") < order.index("b"), "Stage b ran before its dependency a"
+    assert order.index("a") < order.index("c"), "Stage c ran before its dependency a"
+    assert order.index("b") < order.index("d"), "Stage d ran before its dependency b"
+    assert order.index("c") < order.index("d"), "Stage d ran before its dependency c"
+
+
+def test_dependency_cycle_raises(synthetic_project):
+    with pytest.raises(RuntimeError):
+        synthetic_project._run_stages_concurrently(
+            {
+                "a": ((lambda: None), ["b"]),
+                "b": ((lambda: None), ["a"]),
+            }
+        )
+
+
+def test_stage_error_propagates(synthetic_project):
+    def broken():
+        raise ValueError("stage failed")
+
+    with pytest.raises(ValueError):
+        synthetic_project._run_stages_concurrently({"a": (broken, [])})
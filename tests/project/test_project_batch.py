@@ -0,0 +1,70 @@
+# Tests that ProjectBatch builds tile projects as clipped views of shared
+# map data, using a small synthetic MapData instead of files or servers
+
+# internal imports
+from map2loop import ProjectBatch
+from map2loop.m2l_enums import Datatype, VerboseLevel
+from map2loop.sorter import SorterAgeBased
+from map2loop.sampler import SamplerSpacing
+
+# external imports
+import pytest
+
+tile_bounding_boxes = [
+    {"minx": 0, "miny": 0, "maxx": 500, "maxy": 1000, "base": -1000, "top": 0},
+    {"minx": 500, "miny": 0, "maxx": 1000, "maxy": 1000, "base": -1000, "top": 0},
+]
+
+
+def test_create_tile_project_clips_to_tile(synthetic_map_data):
+    batch = ProjectBatch(
+        tile_bounding_boxes,
+        verbose_level=VerboseLevel.NONE,
+        shared_map_data=synthetic_map_data,
+    )
+    tile = batch.create_tile_project(0)
+    geology = tile.map_data.get_map_data(Datatype.GEOLOGY)
+    assert geology is not None, "Tile project has no geology view"
+    assert (
+        geology.total_bounds[2] <= tile_bounding_boxes[0]["maxx"]
+    ), "Tile geology view was not clipped to the tile bounding box"
+
+
+def test_tile_projects_use_distinct_tmp_paths(synthetic_map_data):
+    batch = ProjectBatch(
+        tile_bounding_boxes,
+        verbose_level=VerboseLevel.NONE,
+        shared_map_data=synthetic_map_data,
+    )
+    first = batch.create_tile_project(0)
+    second = batch.create_tile_project(1)
+    assert (
+        first.map_data.tmp_path != second.map_data.tmp_path
+    ), "Concurrent tiles would race on a shared working directory"
+
+
+def test_tile_projects_apply_batch_overrides(synthetic_map_data):
+    batch = ProjectBatch(
+        tile_bounding_boxes,
+        verbose_level=VerboseLevel.NONE,
+        shared_map_data=synthetic_map_data,
+    )
+    batch.set_sorter(SorterAgeBased())
+    batch.set_sampler(Datatype.GEOLOGY, SamplerSpacing(100.0))
+    tile = batch.create_tile_project(1)
+    assert (
+        tile.get_sorter() == "SorterAgeBased"
+    ), "Batch sorter override was not applied to the tile project"
+    assert (
+        tile.samplers[Datatype.GEOLOGY].sampler_label == "SamplerSpacing"
+    ), "Batch sampler override was not applied to the tile project"
+
+
+def test_mismatched_filename_list_raises(synthetic_map_data):
+    with pytest.raises(ValueError):
+        ProjectBatch(
+            tile_bounding_boxes,
+            verbose_level=VerboseLevel.NONE,
+            loop_project_filenames=["only_one.loop3d"],
+            shared_map_data=synthetic_map_data,
+        )
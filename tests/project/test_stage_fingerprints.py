@@ -0,0 +1,44 @@
+# Tests the stage input fingerprinting behind the incremental re-run mode
+
+# internal imports
+from map2loop.m2l_enums import Datatype
+
+
+def test_stage_runs_until_its_fingerprint_is_recorded(synthetic_project):
+    fingerprint = synthetic_project._frame_fingerprint(
+        synthetic_project.map_data.get_map_data(Datatype.GEOLOGY)
+    )
+    assert synthetic_project._stage_changed(
+        "stage", fingerprint
+    ), "A stage with no recorded fingerprint should run"
+    # The check must not record, so a stage that failed part way is re-run
+    assert synthetic_project._stage_changed(
+        "stage", fingerprint
+    ), "A stage whose body never completed should still be due to run"
+    synthetic_project._record_stage("stage", fingerprint)
+    assert not synthetic_project._stage_changed(
+        "stage", fingerprint
+    ), "A completed stage with unchanged inputs should be skipped"
+
+
+def test_fingerprint_tracks_frame_content(synthetic_project):
+    geology = synthetic_project.map_data.get_map_data(Datatype.GEOLOGY)
+    fingerprint = synthetic_project._frame_fingerprint(geology)
+    assert fingerprint == synthetic_project._frame_fingerprint(
+        geology
+    ), "Fingerprinting the same frame twice should match"
+    modified = geology.copy()
+    modified.loc[0, "UNITNAME"] = "unit_renamed"
+    assert fingerprint != synthetic_project._frame_fingerprint(
+        modified
+    ), "Changing a frame's contents should change its fingerprint"
+    assert (
+        synthetic_project._frame_fingerprint(None) == "none"
+    ), "An unset frame should fingerprint as 'none'"
+
+
+def test_changed_inputs_make_a_completed_stage_rerun(synthetic_project):
+    synthetic_project._record_stage("stage", "fingerprint_one")
+    assert synthetic_project._stage_changed(
+        "stage", "fingerprint_two"
+    ), "A stage whose inputs changed should run again"
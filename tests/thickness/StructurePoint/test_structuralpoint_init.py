@@ -0,0 +1,24 @@
+# Tests the StructuralPoint initialiser and its calculation mode flags
+
+# internal imports
+from map2loop.thickness_calculator import StructuralPoint
+
+
+def test_label_matches_other_thickness_calculators():
+    calculator = StructuralPoint()
+    assert (
+        calculator.thickness_calculator_label == "StructuralPoint"
+    ), "StructuralPoint does not expose the thickness_calculator_label the pipeline relies on"
+    assert calculator.type() == "StructuralPoint", "type() should return the calculator label"
+
+
+def test_default_mode_is_per_measurement():
+    calculator = StructuralPoint()
+    assert calculator.use_kdtree is False, "Default mode should be the per-measurement workflow"
+    assert calculator.num_workers == 1, "Default mode should be sequential"
+
+
+def test_mode_flags_are_stored():
+    calculator = StructuralPoint(use_kdtree=True, num_workers=4)
+    assert calculator.use_kdtree is True, "use_kdtree flag was not stored"
+    assert calculator.num_workers == 4, "num_workers was not stored"